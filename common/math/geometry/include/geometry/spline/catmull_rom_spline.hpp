@@ -19,6 +19,7 @@
 #include <geometry/spline/catmull_rom_spline_interface.hpp>
 #include <geometry/spline/hermite_curve.hpp>
 #include <geometry_msgs/msg/point.hpp>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
@@ -33,6 +34,14 @@ class CatmullRomSpline : public CatmullRomSplineInterface
 public:
   CatmullRomSpline() = default;
   explicit CatmullRomSpline(const std::vector<geometry_msgs::msg::Point> & control_points);
+  /**
+   * @brief Join the splines end to end, reusing their curves instead of fitting the concatenated
+   * control points again.
+   * @note Unlike fitting the concatenated control points, the s value at which each spline starts
+   * is exactly the total length of the preceding ones. Splines whose ends do not meet are joined
+   * with a straight curve.
+   */
+  explicit CatmullRomSpline(const std::vector<std::shared_ptr<CatmullRomSpline>> & splines);
   auto getLength() const -> double override { return total_length_; }
   auto getMaximum2DCurvature() const -> double;
   auto getPoint(const double s) const -> geometry_msgs::msg::Point;
@@ -40,11 +49,25 @@ public:
   auto getTangentVector(const double s) const -> geometry_msgs::msg::Vector3;
   auto getNormalVector(const double s) const -> geometry_msgs::msg::Vector3;
   auto getPose(const double s) const -> geometry_msgs::msg::Pose;
+  /**
+   * @brief Evaluate the spline at each of the s values.
+   * @note Each s value is looked up starting from the curve of the previous one, so the curves are
+   * walked only once when the s values are sorted (in ascending or descending order).
+   */
+  auto getPoints(const std::vector<double> & s_values) const
+    -> std::vector<geometry_msgs::msg::Point>;
+  auto getPoints(const std::vector<double> & s_values, const double offset) const
+    -> std::vector<geometry_msgs::msg::Point>;
+  auto getPoses(const std::vector<double> & s_values) const
+    -> std::vector<geometry_msgs::msg::Pose>;
   auto getTrajectory(
     const double start_s, const double end_s, const double resolution,
     const double offset = 0.0) const -> std::vector<geometry_msgs::msg::Point>;
   auto getSValue(const geometry_msgs::msg::Pose & pose, double threshold_distance = 3.0) const
     -> std::optional<double>;
+  auto getSValue(
+    const geometry_msgs::msg::Pose & pose, const double threshold_distance,
+    const double initial_guess_s) const -> std::optional<double>;
   auto getSquaredDistanceIn2D(const geometry_msgs::msg::Point & point, const double s) const
     -> double;
   auto getSquaredDistanceVector(const geometry_msgs::msg::Point & point, const double s) const
@@ -69,12 +92,20 @@ private:
     const -> std::vector<geometry_msgs::msg::Point>;
   auto getSInSplineCurve(const size_t curve_index, const double s) const -> double;
   auto getCurveIndexAndS(const double s) const -> std::pair<size_t, double>;
+  auto getCurveIndexAndS(const double s, const size_t initial_curve_index) const
+    -> std::pair<size_t, double>;
   auto checkConnection() const -> bool;
+  static auto getControlPoints(const std::vector<std::shared_ptr<CatmullRomSpline>> & splines)
+    -> std::vector<geometry_msgs::msg::Point>;
+  auto appendLinearCurve(
+    const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to) -> void;
   auto equals(const geometry_msgs::msg::Point & p0, const geometry_msgs::msg::Point & p1) const
     -> bool;
   std::vector<LineSegment> line_segments_;
   std::vector<HermiteCurve> curves_;
   std::vector<double> length_list_;
+  /// @note S value at the start of each curve, followed by total_length_.
+  std::vector<double> accumulated_lengths_;
   std::vector<double> maximum_2d_curvatures_;
   double total_length_;
 };
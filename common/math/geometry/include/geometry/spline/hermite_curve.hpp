@@ -78,7 +78,28 @@ public:
 
 private:
   std::pair<double, double> get2DMinMaxCurvatureValue() const;
+  double getSpeed(double t) const;
+  double getArcLength(double t0, double t1) const;
+  std::vector<double> getArcLengthTable() const;
+  bool hasConstantSpeed() const;
+  double normalize(double s) const;
+  double denormalize(double t) const;
   double length_;
+  /**
+   * @note Hard coded parameter, number of intervals of the arc length table.
+   * Arc length of a cubic curve is smooth enough to be integrated exactly in practice by a 3 point
+   * Gauss-Legendre rule on each interval.
+   */
+  static constexpr size_t arc_length_table_size = 16;
+  /// @note Arc length from the start of the curve to t = i / arc_length_table_size.
+  std::vector<double> arc_length_table_;
+  /**
+   * @note Hard coded parameter, relative speed variation under which the curve is treated as
+   * having constant speed. The arc length is then proportional to t and normalize / denormalize
+   * skip the table.
+   */
+  static constexpr double constant_speed_tolerance = 1e-6;
+  bool constant_speed_;
 };
 }  // namespace geometry
 }  // namespace math
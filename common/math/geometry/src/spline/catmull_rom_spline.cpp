@@ -12,10 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <geometry/linear_algebra.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
@@ -104,25 +107,22 @@ auto CatmullRomSpline::getTrajectory(
   const double start_s, const double end_s, const double resolution, const double offset) const
   -> std::vector<geometry_msgs::msg::Point>
 {
+  std::vector<double> s_values;
   if (start_s > end_s) {
-    std::vector<geometry_msgs::msg::Point> ret;
     double s = start_s;
     while (s > end_s) {
-      ret.emplace_back(getPoint(s, offset));
+      s_values.push_back(s);
       s = s - std::fabs(resolution);
     }
-    ret.emplace_back(getPoint(end_s, offset));
-    return ret;
   } else {
-    std::vector<geometry_msgs::msg::Point> ret;
     double s = start_s;
     while (s < end_s) {
-      ret.emplace_back(getPoint(s, offset));
+      s_values.push_back(s);
       s = s + std::fabs(resolution);
     }
-    ret.emplace_back(getPoint(end_s, offset));
-    return ret;
   }
+  s_values.push_back(end_s);
+  return getPoints(s_values, offset);
 }
 
 CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point> & control_points)
@@ -238,8 +238,10 @@ CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point>
           maximum_2d_curvatures_.emplace_back(curve.getMaximum2DCurvature());
         }
         total_length_ = 0;
+        accumulated_lengths_.emplace_back(total_length_);
         for (const auto & length : length_list_) {
           total_length_ = total_length_ + length;
+          accumulated_lengths_.emplace_back(total_length_);
         }
         checkConnection();
       }(control_points);
@@ -247,6 +249,73 @@ CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point>
   }
 }
 
+CatmullRomSpline::CatmullRomSpline(const std::vector<std::shared_ptr<CatmullRomSpline>> & splines)
+: control_points(getControlPoints(splines)),
+  line_segments_(getLineSegments(control_points)),
+  total_length_(0)
+{
+  if (control_points.empty()) {
+    THROW_SEMANTIC_ERROR(
+      "Control points are empty. We cannot determine the shape of the curve.",
+      "This message is not originally intended to be displayed, if you see it, please contact "
+      "the developer of traffic_simulator.");
+  }
+  std::optional<geometry_msgs::msg::Point> previous_end;
+  for (const auto & spline : splines) {
+    if (previous_end and spline->control_points.front() != *previous_end) {
+      appendLinearCurve(*previous_end, spline->control_points.front());
+    }
+    previous_end = spline->control_points.back();
+    /// @note A spline with less than 3 control points has no curves, only line segments.
+    if (spline->curves_.empty()) {
+      for (size_t i = 0; i + 1 < spline->control_points.size(); ++i) {
+        appendLinearCurve(spline->control_points[i], spline->control_points[i + 1]);
+      }
+    } else {
+      curves_.insert(curves_.end(), spline->curves_.begin(), spline->curves_.end());
+      length_list_.insert(
+        length_list_.end(), spline->length_list_.begin(), spline->length_list_.end());
+      maximum_2d_curvatures_.insert(
+        maximum_2d_curvatures_.end(), spline->maximum_2d_curvatures_.begin(),
+        spline->maximum_2d_curvatures_.end());
+    }
+  }
+  accumulated_lengths_.emplace_back(total_length_);
+  for (const auto & length : length_list_) {
+    total_length_ = total_length_ + length;
+    accumulated_lengths_.emplace_back(total_length_);
+  }
+  /// @note As in the other constructor, 1 or 2 control points are handled as a point or a line.
+  if (control_points.size() > 2) {
+    checkConnection();
+  }
+}
+
+auto CatmullRomSpline::getControlPoints(
+  const std::vector<std::shared_ptr<CatmullRomSpline>> & splines)
+  -> std::vector<geometry_msgs::msg::Point>
+{
+  std::vector<geometry_msgs::msg::Point> control_points;
+  for (const auto & spline : splines) {
+    control_points.insert(
+      control_points.end(),
+      not control_points.empty() and spline->control_points.front() == control_points.back()
+        ? std::next(spline->control_points.begin())
+        : spline->control_points.begin(),
+      spline->control_points.end());
+  }
+  return control_points;
+}
+
+auto CatmullRomSpline::appendLinearCurve(
+  const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to) -> void
+{
+  curves_.emplace_back(
+    0, 0, to.x - from.x, from.x, 0, 0, to.y - from.y, from.y, 0, 0, to.z - from.z, from.z);
+  length_list_.emplace_back(curves_.back().getLength());
+  maximum_2d_curvatures_.emplace_back(0);
+}
+
 auto CatmullRomSpline::getCurveIndexAndS(const double s) const -> std::pair<size_t, double>
 {
   if (s < 0) {
@@ -256,27 +325,44 @@ auto CatmullRomSpline::getCurveIndexAndS(const double s) const -> std::pair<size
     return std::make_pair(
       curves_.size() - 1, s - (total_length_ - curves_[curves_.size() - 1].getLength()));
   }
-  double current_s = 0;
-  for (size_t i = 0; i < curves_.size(); i++) {
-    double prev_s = current_s;
-    current_s = current_s + length_list_[i];
-    if (prev_s <= s && s < current_s) {
-      return std::make_pair(i, s - prev_s);
-    }
+  /// @note Zero length curves are skipped, because the last curve starting at or before s is taken.
+  const auto next_curve_start =
+    std::upper_bound(accumulated_lengths_.begin(), accumulated_lengths_.end(), s);
+  if (
+    next_curve_start == accumulated_lengths_.begin() ||
+    next_curve_start == accumulated_lengths_.end()) {
+    THROW_SIMULATION_ERROR("failed to calculate curve index");  // LCOV_EXCL_LINE
+  }
+  const auto curve_index =
+    static_cast<size_t>(std::distance(accumulated_lengths_.begin(), next_curve_start) - 1);
+  return std::make_pair(curve_index, s - accumulated_lengths_[curve_index]);
+}
+
+/**
+ * @brief Same as getCurveIndexAndS(s), but searching linearly from the curve initial_curve_index.
+ * Cheaper than the binary search when the s value lies on (or next to) that curve.
+ */
+auto CatmullRomSpline::getCurveIndexAndS(const double s, const size_t initial_curve_index) const
+  -> std::pair<size_t, double>
+{
+  if (!(0 <= s && s < total_length_)) {
+    return getCurveIndexAndS(s);
+  }
+  /// @note Both loops stay in range, because accumulated_lengths_[0] = 0 <= s < total_length_.
+  size_t curve_index = std::min(initial_curve_index, curves_.size() - 1);
+  while (s < accumulated_lengths_[curve_index]) {
+    curve_index--;
   }
-  THROW_SIMULATION_ERROR("failed to calculate curve index");  // LCOV_EXCL_LINE
+  while (accumulated_lengths_[curve_index + 1] <= s) {
+    curve_index++;
+  }
+  return std::make_pair(curve_index, s - accumulated_lengths_[curve_index]);
 }
 
 auto CatmullRomSpline::getSInSplineCurve(const size_t curve_index, const double s) const -> double
 {
-  size_t n = curves_.size();
-  double ret = 0;
-  for (size_t i = 0; i < n; i++) {
-    if (i == curve_index) {
-      return ret + s;
-    } else {
-      ret = ret + curves_[i].getLength();
-    }
+  if (curve_index < curves_.size()) {
+    return accumulated_lengths_[curve_index] + s;
   }
   THROW_SEMANTIC_ERROR("curve index does not match");  // LCOV_EXCL_LINE
 }
@@ -428,19 +514,53 @@ auto CatmullRomSpline::getSValue(
       }
       return line_segments_[0].getSValue(pose, threshold_distance, true);
     default:
-      double s = 0;
       for (size_t i = 0; i < curves_.size(); i++) {
-        auto s_value = curves_[i].getSValue(pose, threshold_distance, true);
-        if (s_value) {
-          s = s + s_value.value();
-          return s;
+        if (const auto s_value = curves_[i].getSValue(pose, threshold_distance, true)) {
+          return getSInSplineCurve(i, s_value.value());
         }
-        s = s + curves_[i].getLength();
       }
       return std::nullopt;
   }
 }
 
+/**
+ * @brief Get s value of the pose, searching the curves outward from the one containing initial_guess_s.
+ * @param pose pose to be matched to the spline.
+ * @param threshold_distance threshold distance of the matching.
+ * @param initial_guess_s first guess of the s value, e.g. obtained from a spatial index.
+ * @return std::optional<double> s value of the curve closest (in curve order) to initial_guess_s.
+ */
+auto CatmullRomSpline::getSValue(
+  const geometry_msgs::msg::Pose & pose, const double threshold_distance,
+  const double initial_guess_s) const -> std::optional<double>
+{
+  /// @note If the spline is a point or a line segment, there is nothing to search.
+  if (control_points.size() <= 2) {
+    return getSValue(pose, threshold_distance);
+  }
+  const auto get_s_value_in_curve = [&](const size_t curve_index) -> std::optional<double> {
+    if (const auto s = curves_[curve_index].getSValue(pose, threshold_distance, true)) {
+      return getSInSplineCurve(curve_index, s.value());
+    }
+    return std::nullopt;
+  };
+  const size_t n = curves_.size();
+  const size_t first = getCurveIndexAndS(std::clamp(initial_guess_s, 0.0, total_length_)).first;
+  for (size_t i = 0; i < n; i++) {
+    if (i <= first) {
+      if (const auto s = get_s_value_in_curve(first - i)) {
+        return s;
+      }
+    }
+    if (i != 0 && first + i < n) {
+      if (const auto s = get_s_value_in_curve(first + i)) {
+        return s;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
 auto CatmullRomSpline::getSquaredDistanceIn2D(
   const geometry_msgs::msg::Point & point, const double s) const -> double
 {
@@ -671,6 +791,71 @@ auto CatmullRomSpline::getPose(const double s) const -> geometry_msgs::msg::Pose
   }
 }
 
+auto CatmullRomSpline::getPoints(const std::vector<double> & s_values) const
+  -> std::vector<geometry_msgs::msg::Point>
+{
+  std::vector<geometry_msgs::msg::Point> points;
+  points.reserve(s_values.size());
+  if (control_points.size() <= 2) {
+    for (const auto s : s_values) {
+      points.push_back(getPoint(s));
+    }
+    return points;
+  }
+  size_t curve_index = 0;
+  for (const auto s : s_values) {
+    const auto index_and_s = getCurveIndexAndS(s, curve_index);
+    curve_index = index_and_s.first;
+    points.push_back(curves_[curve_index].getPoint(index_and_s.second, true));
+  }
+  return points;
+}
+
+auto CatmullRomSpline::getPoints(const std::vector<double> & s_values, const double offset) const
+  -> std::vector<geometry_msgs::msg::Point>
+{
+  std::vector<geometry_msgs::msg::Point> points;
+  points.reserve(s_values.size());
+  if (control_points.size() <= 2) {
+    for (const auto s : s_values) {
+      points.push_back(getPoint(s, offset));
+    }
+    return points;
+  }
+  size_t curve_index = 0;
+  for (const auto s : s_values) {
+    const auto index_and_s = getCurveIndexAndS(s, curve_index);
+    curve_index = index_and_s.first;
+    const auto vec = curves_[curve_index].getNormalVector(index_and_s.second, true);
+    const double theta = std::atan2(vec.y, vec.x);
+    auto point = curves_[curve_index].getPoint(index_and_s.second, true);
+    point.x = point.x + offset * std::cos(theta);
+    point.y = point.y + offset * std::sin(theta);
+    points.push_back(point);
+  }
+  return points;
+}
+
+auto CatmullRomSpline::getPoses(const std::vector<double> & s_values) const
+  -> std::vector<geometry_msgs::msg::Pose>
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  poses.reserve(s_values.size());
+  if (control_points.size() <= 2) {
+    for (const auto s : s_values) {
+      poses.push_back(getPose(s));
+    }
+    return poses;
+  }
+  size_t curve_index = 0;
+  for (const auto s : s_values) {
+    const auto index_and_s = getCurveIndexAndS(s, curve_index);
+    curve_index = index_and_s.first;
+    poses.push_back(curves_[curve_index].getPose(index_and_s.second, true));
+  }
+  return poses;
+}
+
 auto CatmullRomSpline::checkConnection() const -> bool
 {
   if (control_points.size() != (curves_.size() + 1)) {
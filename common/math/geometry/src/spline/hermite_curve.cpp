@@ -17,6 +17,7 @@
 #include <geometry/bounding_box.hpp>
 #include <geometry/spline/hermite_curve.hpp>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <rclcpp/rclcpp.hpp>
@@ -42,7 +43,9 @@ HermiteCurve::HermiteCurve(
   bz_(bz),
   cz_(cz),
   dz_(dz),
-  length_(getLength(100))
+  length_(getLength(100)),
+  arc_length_table_(getArcLengthTable()),
+  constant_speed_(hasConstantSpeed())
 {
 }
 
@@ -65,6 +68,8 @@ HermiteCurve::HermiteCurve(
   cz_ = start_vec.z;
   dz_ = start_pose.position.z;
   length_ = getLength(100);
+  arc_length_table_ = getArcLengthTable();
+  constant_speed_ = hasConstantSpeed();
 }
 
 double HermiteCurve::getSquaredDistanceIn2D(
@@ -158,7 +163,7 @@ std::set<double> HermiteCurve::getCollisionPointsIn2D(
    */
   const auto denormalize = [denormalize_s, this](double s) -> double {
     if (denormalize_s) {
-      return s * getLength();
+      return this->denormalize(s);
     }
     return s;
   };
@@ -212,7 +217,7 @@ std::optional<double> HermiteCurve::getSValue(
     return std::nullopt;
   }
   if (denormalize_s) {
-    return s.value() * getLength();
+    return denormalize(s.value());
   }
   return s.value();
 }
@@ -257,7 +262,7 @@ std::vector<geometry_msgs::msg::Point> HermiteCurve::getTrajectory(size_t num_po
 const geometry_msgs::msg::Vector3 HermiteCurve::getNormalVector(double s, bool denormalize_s) const
 {
   if (denormalize_s) {
-    s = s / getLength();
+    s = normalize(s);
   }
   geometry_msgs::msg::Vector3 tangent_vec = getTangentVector(s);
   double theta = M_PI / 2.0;
@@ -270,7 +275,7 @@ const geometry_msgs::msg::Vector3 HermiteCurve::getNormalVector(double s, bool d
 const geometry_msgs::msg::Vector3 HermiteCurve::getTangentVector(double s, bool denormalize_s) const
 {
   if (denormalize_s) {
-    s = s / getLength();
+    s = normalize(s);
   }
   geometry_msgs::msg::Vector3 vec;
   vec.x = 3 * ax_ * s * s + 2 * bx_ * s + cx_;
@@ -282,7 +287,7 @@ const geometry_msgs::msg::Vector3 HermiteCurve::getTangentVector(double s, bool
 const geometry_msgs::msg::Pose HermiteCurve::getPose(double s, bool denormalize_s) const
 {
   if (denormalize_s) {
-    s = s / getLength();
+    s = normalize(s);
   }
   geometry_msgs::msg::Pose pose;
   geometry_msgs::msg::Vector3 tangent_vec = getTangentVector(s, false);
@@ -298,7 +303,7 @@ const geometry_msgs::msg::Pose HermiteCurve::getPose(double s, bool denormalize_
 double HermiteCurve::get2DCurvature(double s, bool denormalize_s) const
 {
   if (denormalize_s) {
-    s = s / getLength();
+    s = normalize(s);
   }
   double s2 = s * s;
   double x_dot = 3 * ax_ * s2 + 2 * bx_ * s + cx_;
@@ -356,10 +361,108 @@ double HermiteCurve::getLength(size_t num_points) const
   return ret;
 }
 
+double HermiteCurve::getSpeed(double t) const
+{
+  const auto tangent_vec = getTangentVector(t);
+  return std::sqrt(
+    tangent_vec.x * tangent_vec.x + tangent_vec.y * tangent_vec.y + tangent_vec.z * tangent_vec.z);
+}
+
+/**
+ * @brief Integrate the speed of the curve over [t0, t1] by the 3 point Gauss-Legendre rule.
+ */
+double HermiteCurve::getArcLength(double t0, double t1) const
+{
+  const double center = (t0 + t1) * 0.5;
+  const double half_width = (t1 - t0) * 0.5;
+  const double node = half_width * std::sqrt(0.6);
+  return half_width *
+         (5.0 * getSpeed(center - node) + 8.0 * getSpeed(center) + 5.0 * getSpeed(center + node)) /
+         9.0;
+}
+
+std::vector<double> HermiteCurve::getArcLengthTable() const
+{
+  std::vector<double> table{0.0};
+  table.reserve(arc_length_table_size + 1);
+  for (size_t i = 0; i < arc_length_table_size; i++) {
+    table.push_back(
+      table.back() + getArcLength(
+                       static_cast<double>(i) / arc_length_table_size,
+                       static_cast<double>(i + 1) / arc_length_table_size));
+  }
+  return table;
+}
+
+/**
+ * @brief Check whether the speed of the curve is the same at every node of the arc length table.
+ * @note The squared speed is a polynomial of degree 4 in t, so if it takes the same value at the
+ * 17 nodes of the table it is constant over the whole curve.
+ */
+bool HermiteCurve::hasConstantSpeed() const
+{
+  const double speed = getSpeed(0);
+  for (size_t i = 1; i <= arc_length_table_size; i++) {
+    if (
+      std::abs(getSpeed(static_cast<double>(i) / arc_length_table_size) - speed) >
+      constant_speed_tolerance * speed) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Convert the arc length along the curve into the curve parameter t.
+ * The arc length table gives the first guess, which is refined by a single Newton step.
+ * @note The table is scaled to getLength(), so s ranges over [0, getLength()] as before. Outside
+ * that range, or if the curve has constant speed, s is converted linearly without the table.
+ */
+double HermiteCurve::normalize(double s) const
+{
+  const double table_length = arc_length_table_.back();
+  if (constant_speed_ || !(0 <= s && s <= length_) || table_length <= 0) {
+    return s / length_;
+  }
+  const double target = s * table_length / length_;
+  const size_t i = std::min<size_t>(
+    std::distance(
+      arc_length_table_.begin(),
+      std::upper_bound(arc_length_table_.begin(), arc_length_table_.end(), target)) -
+      1,
+    arc_length_table_size - 1);
+  const double interval = 1.0 / arc_length_table_size;
+  const double t_i = i * interval;
+  const double length_in_interval = arc_length_table_[i + 1] - arc_length_table_[i];
+  double t = t_i;
+  if (length_in_interval > 0) {
+    t = t_i + (target - arc_length_table_[i]) / length_in_interval * interval;
+  }
+  if (const double speed = getSpeed(t); speed > 0) {
+    t = t - (arc_length_table_[i] + getArcLength(t_i, t) - target) / speed;
+  }
+  return std::clamp(t, 0.0, 1.0);
+}
+
+/**
+ * @brief Convert the curve parameter t into the arc length along the curve, inverse of normalize.
+ */
+double HermiteCurve::denormalize(double t) const
+{
+  const double table_length = arc_length_table_.back();
+  if (constant_speed_ || !(0 <= t && t <= 1) || table_length <= 0) {
+    return t * length_;
+  }
+  const size_t i =
+    std::min(static_cast<size_t>(t * arc_length_table_size), arc_length_table_size - 1);
+  const double t_i = static_cast<double>(i) / arc_length_table_size;
+  return (arc_length_table_[i] + getArcLength(t_i, t)) * length_ / table_length;
+}
+
 const geometry_msgs::msg::Point HermiteCurve::getPoint(double s, bool denormalize_s) const
 {
   if (denormalize_s) {
-    s = s / getLength();
+    s = normalize(s);
   }
   geometry_msgs::msg::Point p;
 
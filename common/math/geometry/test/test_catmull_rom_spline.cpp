@@ -15,7 +15,9 @@
 #include <gtest/gtest.h>
 
 #include <geometry/spline/catmull_rom_spline.hpp>
+#include <memory>
 #include <scenario_simulator_exception/exception.hpp>
+#include <vector>
 
 #include "expect_eq_macros.hpp"
 #include "test_utils.hpp"
@@ -276,11 +278,11 @@ TEST(CatmullRomSpline, getCollisionPointIn2DPolygon)
 
   const auto collision_s0 = spline.getCollisionPointIn2D(polygon);
   EXPECT_TRUE(collision_s0);
-  EXPECT_NEAR(collision_s0.value(), 0.56727227, EPS);
+  EXPECT_NEAR(collision_s0.value(), 0.73096295, EPS);
 
   const auto collision_s1 = spline.getCollisionPointIn2D(polygon, true);
   EXPECT_TRUE(collision_s1);
-  EXPECT_NEAR(collision_s1.value(), 0.56727227, EPS);
+  EXPECT_NEAR(collision_s1.value(), 0.73096295, EPS);
 }
 
 TEST(CatmullRomSpline, getCollisionPointIn2DEmpty)
@@ -407,6 +409,25 @@ TEST(CatmullRomSpline, getPointCurve)
   EXPECT_POINT_NEAR(point, makePoint(1.0, 1.0), eps);
 }
 
+TEST(CatmullRomSpline, getPoints)
+{
+  const math::geometry::CatmullRomSpline spline(std::vector<geometry_msgs::msg::Point>{
+    makePoint(0.0, 0.0), makePoint(1.0, 1.0), makePoint(2.0, 0.0), makePoint(3.0, 1.0),
+    makePoint(4.0, 0.0)});
+  const std::vector<double> s_values{-0.5, 0.0, 0.7, 2.1, 2.0, 4.9, spline.getLength(), 10.0};
+  const auto points = spline.getPoints(s_values);
+  const auto points_with_offset = spline.getPoints(s_values, 0.5);
+  const auto poses = spline.getPoses(s_values);
+  ASSERT_EQ(points.size(), s_values.size());
+  ASSERT_EQ(points_with_offset.size(), s_values.size());
+  ASSERT_EQ(poses.size(), s_values.size());
+  for (size_t i = 0; i < s_values.size(); ++i) {
+    EXPECT_POINT_EQ(points[i], spline.getPoint(s_values[i]));
+    EXPECT_POINT_EQ(points_with_offset[i], spline.getPoint(s_values[i], 0.5));
+    EXPECT_POSE_EQ(poses[i], spline.getPose(s_values[i]));
+  }
+}
+
 TEST(CatmullRomSpline, getTangentVectorLine)
 {
   const math::geometry::CatmullRomSpline spline = makeLine();
@@ -515,7 +536,18 @@ TEST(CatmullRomSpline, getSValue2)
   pose1.orientation.w = 0.894575;
   const auto result1 = spline.getSValue(pose1);
   EXPECT_TRUE(result1);
-  EXPECT_DOUBLE_EQ(result1.value(), 0.42440442127906564);
+  EXPECT_DOUBLE_EQ(result1.value(), 0.42440442127874367);
+}
+
+TEST(CatmullRomSpline, getSValueWithInitialGuess)
+{
+  const std::vector<geometry_msgs::msg::Point> points{
+    makePoint(0.0, 0.0), makePoint(1.0, 0.0), makePoint(2.0, 0.0), makePoint(4.0, 0.0)};
+  const auto spline = math::geometry::CatmullRomSpline(points);
+  const auto result = spline.getSValue(makePose(2.5, 0.0), 3.0, 3.0);
+  EXPECT_TRUE(result);
+  EXPECT_NEAR(result.value(), spline.getSValue(makePose(2.5, 0.0)).value(), EPS);
+  EXPECT_FALSE(spline.getSValue(makePose(10.0, 0.0), 3.0, 0.0));
 }
 
 TEST(CatmullRomSpline, getSValueEdge)
@@ -528,28 +560,28 @@ TEST(CatmullRomSpline, getSValueEdge)
 TEST(CatmullRomSpline, getSquaredDistanceIn2D)
 {
   const math::geometry::CatmullRomSpline spline = makeCurve2();
-  const auto distance = spline.getSquaredDistanceIn2D(makePoint(2.0, 2.0), 1.47895776);
+  const auto distance = spline.getSquaredDistanceIn2D(makePoint(2.0, 2.0), 1.4851381);
   EXPECT_NEAR(distance, 2.0, 1e-2);
 }
 
 TEST(CatmullRomSpline, getSquaredDistanceIn2DSamePoint)
 {
   const math::geometry::CatmullRomSpline spline = makeCurve2();
-  const auto distance = spline.getSquaredDistanceIn2D(makePoint(1.0, 1.0), 1.47895776);
+  const auto distance = spline.getSquaredDistanceIn2D(makePoint(1.0, 1.0), 1.4851381);
   EXPECT_NEAR(distance, 0.0, 1e-2);
 }
 
 TEST(CatmullRomSpline, getSquaredDistanceVector)
 {
   const math::geometry::CatmullRomSpline spline = makeCurve2();
-  const auto vector = spline.getSquaredDistanceVector(makePoint(2.0, 2.0), 1.47895776);
+  const auto vector = spline.getSquaredDistanceVector(makePoint(2.0, 2.0), 1.4851381);
   EXPECT_POINT_NEAR(vector, makeVector(1.0, 1.0), 1e-2);
 }
 
 TEST(CatmullRomSpline, getSquaredDistanceVectorSamePoint)
 {
   const math::geometry::CatmullRomSpline spline = makeCurve2();
-  const auto vector = spline.getSquaredDistanceVector(makePoint(1.0, 1.0), 1.47895776);
+  const auto vector = spline.getSquaredDistanceVector(makePoint(1.0, 1.0), 1.4851381);
   EXPECT_POINT_NEAR(vector, makeVector(0.0, 0.0), 1e-2);
 }
 
@@ -580,20 +612,20 @@ TEST(CatmullRomSpline, getTrajectoryCurve)
 
   const auto trajectory = spline.getTrajectory(0.0, 2.957916, 0.5);
   EXPECT_POINT_NEAR(trajectory[0], makePoint(0.0, 0.0), EPS);
-  EXPECT_POINT_NEAR(trajectory[1], makePoint(0.559992, 0.336669), EPS);
-  EXPECT_POINT_NEAR(trajectory[2], makePoint(0.893292, 0.673338), EPS);
-  EXPECT_POINT_NEAR(trajectory[3], makePoint(0.999898, 1.010091), EPS);
-  EXPECT_POINT_NEAR(trajectory[4], makePoint(0.87779, 1.349586), EPS);
-  EXPECT_POINT_NEAR(trajectory[5], makePoint(0.525168, 1.68908), EPS);
+  EXPECT_POINT_NEAR(trajectory[1], makePoint(0.432257, 0.246513), EPS);
+  EXPECT_POINT_NEAR(trajectory[2], makePoint(0.811941, 0.566342), EPS);
+  EXPECT_POINT_NEAR(trajectory[3], makePoint(0.999777, 1.014922), EPS);
+  EXPECT_POINT_NEAR(trajectory[4], makePoint(0.789365, 1.45895), EPS);
+  EXPECT_POINT_NEAR(trajectory[5], makePoint(0.400394, 1.774343), EPS);
   EXPECT_POINT_NEAR(trajectory[6], makePoint(0.0, 2.0), EPS);
 
   const auto trajectory_offset = spline.getTrajectory(0.0, 2.957916, 0.5, -1.0);
   EXPECT_POINT_NEAR(trajectory_offset[0], makePoint(0.447214, -0.894427), EPS);
-  EXPECT_POINT_NEAR(trajectory_offset[1], makePoint(1.161918, -0.461883), EPS);
-  EXPECT_POINT_NEAR(trajectory_offset[2], makePoint(1.730462, 0.126395), EPS);
-  EXPECT_POINT_NEAR(trajectory_offset[3], makePoint(1.999695, 1.030269), EPS);
-  EXPECT_POINT_NEAR(trajectory_offset[4], makePoint(1.697341, 1.922592), EPS);
-  EXPECT_POINT_NEAR(trajectory_offset[5], makePoint(1.112457, 2.498458), EPS);
+  EXPECT_POINT_NEAR(trajectory_offset[1], makePoint(0.985176, -0.586722), EPS);
+  EXPECT_POINT_NEAR(trajectory_offset[2], makePoint(1.567388, -0.088868), EPS);
+  EXPECT_POINT_NEAR(trajectory_offset[3], makePoint(1.999332, 1.044752), EPS);
+  EXPECT_POINT_NEAR(trajectory_offset[4], makePoint(1.526067, 2.135167), EPS);
+  EXPECT_POINT_NEAR(trajectory_offset[5], makePoint(0.942845, 2.61443), EPS);
   EXPECT_POINT_NEAR(trajectory_offset[6], makePoint(0.447213, 2.894428), EPS);
 }
 
@@ -613,6 +645,38 @@ TEST(CatmullRomSpline, initializationNotEnoughControlPoints)
   EXPECT_THROW(math::geometry::CatmullRomSpline{points}, common::SemanticError);
 }
 
+TEST(CatmullRomSpline, initializationFromSplines)
+{
+  const auto first = std::make_shared<math::geometry::CatmullRomSpline>(makeCurve());
+  const auto second =
+    std::make_shared<math::geometry::CatmullRomSpline>(std::vector<geometry_msgs::msg::Point>{
+      makePoint(2.0, 0.0), makePoint(3.0, -1.0), makePoint(4.0, 0.0)});
+  const auto spline = math::geometry::CatmullRomSpline({first, second});
+  EXPECT_EQ(spline.control_points.size(), 5U);
+  EXPECT_NEAR(spline.getLength(), first->getLength() + second->getLength(), EPS);
+  EXPECT_POINT_NEAR(spline.getPoint(0.5), first->getPoint(0.5), EPS);
+  EXPECT_POINT_NEAR(spline.getPoint(first->getLength()), makePoint(2.0, 0.0), EPS);
+  EXPECT_POINT_NEAR(spline.getPoint(first->getLength() + 0.3), second->getPoint(0.3), EPS);
+}
+
+TEST(CatmullRomSpline, initializationFromDisconnectedSplines)
+{
+  const auto first = std::make_shared<math::geometry::CatmullRomSpline>(makeLine());
+  const auto second =
+    std::make_shared<math::geometry::CatmullRomSpline>(std::vector<geometry_msgs::msg::Point>{
+      makePoint(2.0, 7.0), makePoint(2.0, 8.0), makePoint(2.0, 9.0)});
+  const auto spline = math::geometry::CatmullRomSpline({first, second});
+  EXPECT_EQ(spline.control_points.size(), 6U);
+  EXPECT_NEAR(spline.getLength(), first->getLength() + 1.0 + second->getLength(), EPS);
+  EXPECT_POINT_NEAR(spline.getPoint(first->getLength() + 0.5), makePoint(2.0, 6.5), EPS);
+}
+
+TEST(CatmullRomSpline, initializationFromNoSplines)
+{
+  const std::vector<std::shared_ptr<math::geometry::CatmullRomSpline>> splines;
+  EXPECT_THROW(math::geometry::CatmullRomSpline{splines}, common::SemanticError);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -335,6 +335,49 @@ TEST(HermiteCurveTest, getSValueAutoscale)
   EXPECT_NEAR(s2.value(), 2.0 * std::sqrt(2.0), EPS);
 }
 
+TEST(HermiteCurveTest, getPointAutoscaleArcLength)
+{
+  const auto curve = makeCurve1();
+  constexpr size_t num_points = 20;
+  const double step = curve.getLength() / num_points;
+  for (size_t i = 0; i < num_points; ++i) {
+    const auto p0 = curve.getPoint(i * step, true);
+    const auto p1 = curve.getPoint((i + 1) * step, true);
+    EXPECT_NEAR(std::hypot(p1.x - p0.x, p1.y - p0.y), step, EPS);
+  }
+}
+
+TEST(HermiteCurveTest, getSValueAutoscaleInverse)
+{
+  const auto curve = makeCurve1();
+  for (const double s : {0.0, 0.3, 0.8, 1.2, curve.getLength()}) {
+    const auto s_value = curve.getSValue(curve.getPose(s, true), 1.0, true);
+    EXPECT_TRUE(s_value);
+    EXPECT_NEAR(s_value.value(), s, EPS);
+  }
+}
+
+TEST(HermiteCurveTest, getPointAutoscaleConstantSpeed)
+{
+  const auto curve = makeLine1();
+  for (const double s : {0.0, 0.25, 0.5, 0.75, 1.0}) {
+    EXPECT_POINT_NEAR(curve.getPoint(s, true), makePoint(s, 0.0), EPS);
+    EXPECT_NEAR(curve.getSValue(makePose(s, 0.0), 1.0, true).value(), s, EPS);
+  }
+}
+
+/// @note Straight line whose speed is not constant, the arc length table must still be used.
+TEST(HermiteCurveTest, getPointAutoscaleVaryingSpeed)
+{
+  const auto curve = makeLine2();
+  constexpr size_t num_points = 20;
+  const double step = curve.getLength() / num_points;
+  for (size_t i = 0; i <= num_points; ++i) {
+    const double expected = i * step / std::sqrt(2.0);
+    EXPECT_POINT_NEAR(curve.getPoint(i * step, true), makePoint(expected, expected), EPS);
+  }
+}
+
 TEST(HermiteCurveTest, getSquaredDistanceIn2D)
 {
   const auto curve = makeLine2();
@@ -73,6 +73,10 @@ public:
   auto set(const geometry_msgs::msg::Pose &) -> void;
 
   virtual auto rethrow() -> void;
+
+  // Called once per simulation step with the ROS time of the step, which is also used as the stamp
+  // of the messages published for the step.
+  virtual auto updateOnSimulationStep(const rclcpp::Time & current_time) -> void;
 };
 }  // namespace concealer
 
@@ -22,8 +22,10 @@
 #include <autoware_auto_vehicle_msgs/msg/steering_report.hpp>
 #include <autoware_auto_vehicle_msgs/msg/turn_indicators_report.hpp>
 #include <autoware_auto_vehicle_msgs/msg/velocity_report.hpp>
+#include <chrono>
 #include <concealer/autoware.hpp>
 #include <concealer/publisher_wrapper.hpp>
+#include <concealer/simulation_step_timer.hpp>
 #include <concealer/subscriber_wrapper.hpp>
 #include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
 #include <nav_msgs/msg/odometry.hpp>
@@ -51,10 +53,22 @@ class AutowareUniverse : public Autoware
   PublisherWrapper<autoware_auto_vehicle_msgs::msg::TurnIndicatorsReport> setTurnIndicatorsReport;
   // clang-format on
 
+  // If true, localization and vehicle state are published from updateOnSimulationStep at the
+  // required rates in simulated time instead of by wall clock timers.
+  const bool publish_on_simulation_step;
+
+  SimulationStepTimer localization_update_step_timer;
+
+  SimulationStepTimer vehicle_state_update_step_timer;
+
   const rclcpp::TimerBase::SharedPtr localization_update_timer;
 
   const rclcpp::TimerBase::SharedPtr vehicle_state_update_timer;
 
+  rclcpp::executors::SingleThreadedExecutor executor;
+
+  std::atomic<std::chrono::nanoseconds> update_thread_cpu_time = std::chrono::nanoseconds(0);
+
   std::thread localization_and_vehicle_state_update_thread;
 
   std::atomic<bool> is_stop_requested = false;
@@ -66,21 +80,23 @@ class AutowareUniverse : public Autoware
   auto stopAndJoin() -> void;
 
 public:
-  CONCEALER_PUBLIC explicit AutowareUniverse();
+  CONCEALER_PUBLIC explicit AutowareUniverse(const bool publish_on_simulation_step = false);
 
   ~AutowareUniverse();
 
   auto rethrow() -> void override;
 
+  auto updateOnSimulationStep(const rclcpp::Time & current_time) -> void override;
+
   auto getAcceleration() const -> double override;
 
   auto getSteeringAngle() const -> double override;
 
   auto getVelocity() const -> double override;
 
-  auto updateLocalization() -> void;
+  auto updateLocalization(const rclcpp::Time & stamp) -> void;
 
-  auto updateVehicleState() -> void;
+  auto updateVehicleState(const rclcpp::Time & stamp) -> void;
 
   auto getGearCommand() const -> autoware_auto_vehicle_msgs::msg::GearCommand override;
 
@@ -91,6 +107,9 @@ public:
     autoware_auto_vehicle_msgs::msg::GearCommand> override;
 
   auto getRouteLanelets() const -> std::vector<std::int64_t>;
+
+  // CPU time consumed by the thread publishing localization and vehicle state.
+  auto getUpdateThreadCpuTime() const noexcept -> std::chrono::nanoseconds;
 };
 
 }  // namespace concealer
@@ -0,0 +1,40 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONCEALER__SIMULATION_STEP_TIMER_HPP_
+#define CONCEALER__SIMULATION_STEP_TIMER_HPP_
+
+#include <chrono>
+#include <optional>
+#include <rclcpp/rclcpp.hpp>
+
+namespace concealer
+{
+// Timer driven by the time of each simulation step instead of the wall clock. A period that elapses
+// several times within one step is reported once, since the step has only one state to publish.
+class SimulationStepTimer
+{
+  const rclcpp::Duration period;
+
+  std::optional<rclcpp::Time> next_time;
+
+public:
+  explicit SimulationStepTimer(const std::chrono::nanoseconds & period);
+
+  // Returns true if the period has elapsed at current_time. The first call always returns true.
+  auto isDue(const rclcpp::Time & current_time) -> bool;
+};
+}  // namespace concealer
+
+#endif  // CONCEALER__SIMULATION_STEP_TIMER_HPP_
@@ -16,6 +16,8 @@
 #define CONCEALER__TASK_QUEUE_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
 #include <functional>
 #include <mutex>
@@ -32,6 +34,10 @@ class TaskQueue
 
   std::mutex thunks_mutex;
 
+  std::condition_variable thunks_condition;
+
+  std::atomic<std::chrono::nanoseconds> dispatcher_cpu_time = std::chrono::nanoseconds(0);
+
   std::thread dispatcher;
 
   std::atomic<bool> is_stop_requested = false;
@@ -51,12 +57,18 @@ public:
   decltype(auto) delay(F && f)
   {
     rethrow();
-    std::unique_lock lk(thunks_mutex);
-    thunks.emplace(std::forward<F>(f));
+    {
+      std::unique_lock lk(thunks_mutex);
+      thunks.emplace(std::forward<F>(f));
+    }
+    thunks_condition.notify_one();
   }
 
   bool exhausted() const noexcept;
 
+  // CPU time consumed by the dispatcher thread, which should stay near zero while idle.
+  auto getDispatcherCpuTime() const noexcept -> std::chrono::nanoseconds;
+
   void rethrow() const;
 };
 }  // namespace concealer
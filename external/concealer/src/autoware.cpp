@@ -58,4 +58,6 @@ auto Autoware::getTurnIndicatorsCommand() const
 }
 
 auto Autoware::rethrow() -> void {}
+
+auto Autoware::updateOnSimulationStep(const rclcpp::Time &) -> void {}
 }  // namespace concealer
@@ -12,11 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <chrono>
 #include <concealer/autoware_universe.hpp>
+#include <concealer/thread_cpu_time.hpp>
 
 namespace concealer
 {
-AutowareUniverse::AutowareUniverse()
+// Autoware.Universe requires localization topics to send data at 50Hz
+static constexpr auto localization_update_period = std::chrono::milliseconds(20);
+
+// Autoware.Universe requires vehicle state topics to send data at 30Hz
+static constexpr auto vehicle_state_update_period = std::chrono::milliseconds(33);
+
+AutowareUniverse::AutowareUniverse(const bool publish_on_simulation_step)
 : getAckermannControlCommand("/control/command/control_cmd", *this),
   getGearCommandImpl("/control/command/gear_cmd", *this),
   getTurnIndicatorsCommand("/control/command/turn_indicators_cmd", *this),
@@ -29,16 +38,30 @@ AutowareUniverse::AutowareUniverse()
   setControlModeReport("/vehicle/status/control_mode", *this),
   setVelocityReport("/vehicle/status/velocity_status", *this),
   setTurnIndicatorsReport("/vehicle/status/turn_indicators_status", *this),
-  // Autoware.Universe requires localization topics to send data at 50Hz
-  localization_update_timer(rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(20), [this]() { updateLocalization(); })),
-  // Autoware.Universe requires vehicle state topics to send data at 30Hz
-  vehicle_state_update_timer(rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(33), [this]() { updateVehicleState(); })),
+  publish_on_simulation_step(publish_on_simulation_step),
+  localization_update_step_timer(localization_update_period),
+  vehicle_state_update_step_timer(vehicle_state_update_period),
+  localization_update_timer(
+    publish_on_simulation_step
+      ? nullptr
+      : rclcpp::create_timer(
+          this, get_clock(), localization_update_period,
+          [this]() { updateLocalization(get_clock()->now()); })),
+  vehicle_state_update_timer(
+    publish_on_simulation_step
+      ? nullptr
+      : rclcpp::create_timer(
+          this, get_clock(), vehicle_state_update_period,
+          [this]() { updateVehicleState(get_clock()->now()); })),
   localization_and_vehicle_state_update_thread(std::thread([this]() {
     try {
+      executor.add_node(get_node_base_interface());
+      // NOTE: spin_once sleeps until a timer or subscription is ready, and stopAndJoin wakes it
+      // through executor.cancel(). The timeout only covers a stop requested between the check of
+      // is_stop_requested and the start of spin_once, which cancel() cannot interrupt.
       while (rclcpp::ok() and not is_stop_requested.load()) {
-        rclcpp::spin_some(get_node_base_interface());
+        executor.spin_once(std::chrono::milliseconds(100));
+        update_thread_cpu_time.store(getThreadCpuTime());
       }
     } catch (...) {
       thrown = std::current_exception();
@@ -57,10 +80,27 @@ auto AutowareUniverse::rethrow() -> void
   }
 }
 
+auto AutowareUniverse::updateOnSimulationStep(const rclcpp::Time & current_time) -> void
+{
+  if (publish_on_simulation_step) {
+    if (localization_update_step_timer.isDue(current_time)) {
+      updateLocalization(current_time);
+    }
+    if (vehicle_state_update_step_timer.isDue(current_time)) {
+      updateVehicleState(current_time);
+    }
+  }
+}
+
 auto AutowareUniverse::stopAndJoin() -> void
 {
   is_stop_requested.store(true);
+  executor.cancel();
   localization_and_vehicle_state_update_thread.join();
+  RCLCPP_DEBUG_STREAM(
+    get_logger(), "Localization and vehicle state update thread used "
+                    << std::chrono::duration<double>(getUpdateThreadCpuTime()).count()
+                    << " seconds of CPU time.");
 }
 
 auto AutowareUniverse::getAcceleration() const -> double
@@ -78,11 +118,11 @@ auto AutowareUniverse::getSteeringAngle() const -> double
   return getAckermannControlCommand().lateral.steering_tire_angle;
 }
 
-auto AutowareUniverse::updateLocalization() -> void
+auto AutowareUniverse::updateLocalization(const rclcpp::Time & stamp) -> void
 {
-  setAcceleration([this]() {
+  setAcceleration([this, &stamp]() {
     geometry_msgs::msg::AccelWithCovarianceStamped message;
-    message.header.stamp = get_clock()->now();
+    message.header.stamp = stamp;
     message.header.frame_id = "/base_link";
     message.accel.accel = current_acceleration.load();
     message.accel.covariance.at(6 * 0 + 0) = 0.001;  // linear x
@@ -94,9 +134,9 @@ auto AutowareUniverse::updateLocalization() -> void
     return message;
   }());
 
-  setOdometry([this]() {
+  setOdometry([this, &stamp]() {
     nav_msgs::msg::Odometry message;
-    message.header.stamp = get_clock()->now();
+    message.header.stamp = stamp;
     message.header.frame_id = "map";
     message.pose.pose = current_pose.load();
     message.pose.covariance = {};
@@ -107,7 +147,7 @@ auto AutowareUniverse::updateLocalization() -> void
   setTransform(current_pose.load());
 }
 
-auto AutowareUniverse::updateVehicleState() -> void
+auto AutowareUniverse::updateVehicleState(const rclcpp::Time & stamp) -> void
 {
   setControlModeReport([this]() {
     autoware_auto_vehicle_msgs::msg::ControlModeReport message;
@@ -115,24 +155,24 @@ auto AutowareUniverse::updateVehicleState() -> void
     return message;
   }());
 
-  setGearReport([this]() {
+  setGearReport([this, &stamp]() {
     autoware_auto_vehicle_msgs::msg::GearReport message;
-    message.stamp = get_clock()->now();
+    message.stamp = stamp;
     message.report = getGearCommand().command;
     return message;
   }());
 
-  setSteeringReport([this]() {
+  setSteeringReport([this, &stamp]() {
     autoware_auto_vehicle_msgs::msg::SteeringReport message;
-    message.stamp = get_clock()->now();
+    message.stamp = stamp;
     message.steering_tire_angle = getSteeringAngle();
     return message;
   }());
 
-  setVelocityReport([this]() {
+  setVelocityReport([this, &stamp]() {
     const auto twist = current_twist.load();
     autoware_auto_vehicle_msgs::msg::VelocityReport message;
-    message.header.stamp = get_clock()->now();
+    message.header.stamp = stamp;
     message.header.frame_id = "base_link";
     message.longitudinal_velocity = twist.linear.x;
     message.lateral_velocity = twist.linear.y;
@@ -140,9 +180,9 @@ auto AutowareUniverse::updateVehicleState() -> void
     return message;
   }());
 
-  setTurnIndicatorsReport([this]() {
+  setTurnIndicatorsReport([this, &stamp]() {
     autoware_auto_vehicle_msgs::msg::TurnIndicatorsReport message;
-    message.stamp = get_clock()->now();
+    message.stamp = stamp;
     message.report = getTurnIndicatorsCommand().command;
     return message;
   }());
@@ -177,4 +217,9 @@ auto AutowareUniverse::getRouteLanelets() const -> std::vector<std::int64_t>
   }
   return ids;
 }
+
+auto AutowareUniverse::getUpdateThreadCpuTime() const noexcept -> std::chrono::nanoseconds
+{
+  return update_thread_cpu_time.load();
+}
 }  // namespace concealer
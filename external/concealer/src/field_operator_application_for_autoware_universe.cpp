@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <boost/range/adaptor/sliced.hpp>
+#include <chrono>
 #include <concealer/field_operator_application_for_autoware_universe.hpp>
 #include <concealer/has_data_member_allow_goal_modification.hpp>
 #include <concealer/has_data_member_option.hpp>
@@ -25,6 +26,10 @@ FieldOperatorApplicationFor<AutowareUniverse>::~FieldOperatorApplicationFor()
   shutdownAutoware();
   // All tasks should be complete before the services used in them will be deinitialized.
   task_queue.stopAndJoin();
+  RCLCPP_DEBUG_STREAM(
+    get_logger(), "Task queue dispatcher used "
+                    << std::chrono::duration<double>(task_queue.getDispatcherCpuTime()).count()
+                    << " seconds of CPU time.");
 }
 
 template <auto N, typename Tuples>
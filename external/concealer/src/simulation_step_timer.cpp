@@ -0,0 +1,37 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <concealer/simulation_step_timer.hpp>
+
+namespace concealer
+{
+SimulationStepTimer::SimulationStepTimer(const std::chrono::nanoseconds & period) : period(period)
+{
+}
+
+auto SimulationStepTimer::isDue(const rclcpp::Time & current_time) -> bool
+{
+  if (not next_time or next_time.value() <= current_time) {
+    /*
+       NOTE: The next time advances by the period to keep the phase, but never stays behind the
+       current time, so that a long step is not followed by a burst of steps catching up.
+    */
+    next_time = std::max(next_time.value_or(current_time) + period, current_time);
+    return true;
+  } else {
+    return false;
+  }
+}
+}  // namespace concealer
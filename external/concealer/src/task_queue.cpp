@@ -14,26 +14,30 @@
 
 #include <chrono>
 #include <concealer/task_queue.hpp>
+#include <concealer/thread_cpu_time.hpp>
 #include <rclcpp/rclcpp.hpp>
 
-/// @todo: pzyskowski : use conditional variables to wait for new messages instead of sleep_for
 namespace concealer
 {
 TaskQueue::TaskQueue()
 : dispatcher([this] {
     try {
       while (rclcpp::ok() and not is_stop_requested.load(std::memory_order_acquire)) {
-        if (auto lock = std::unique_lock(thunks_mutex); not thunks.empty()) {
+        auto lock = std::unique_lock(thunks_mutex);
+        // NOTE: The timeout only bounds how late rclcpp shutdown is noticed, since nothing
+        // notifies this condition variable on shutdown. New tasks wake the dispatcher at once.
+        thunks_condition.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+          return not thunks.empty() or is_stop_requested.load(std::memory_order_acquire);
+        });
+        if (not thunks.empty() and not is_stop_requested.load(std::memory_order_acquire)) {
           // NOTE: To ensure that the task to be queued is completed as expected is the
           // responsibility of the side to create a task.
           auto thunk = std::move(thunks.front());
           thunks.pop();
           lock.unlock();
           thunk();
-        } else {
-          lock.unlock();
-          std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
+        dispatcher_cpu_time.store(getThreadCpuTime(), std::memory_order_relaxed);
       }
     } catch (...) {
       thrown = std::current_exception();
@@ -46,7 +50,11 @@ TaskQueue::TaskQueue()
 void TaskQueue::stopAndJoin()
 {
   if (dispatcher.joinable()) {
-    is_stop_requested.store(true, std::memory_order_release);
+    {
+      std::unique_lock lock(thunks_mutex);
+      is_stop_requested.store(true, std::memory_order_release);
+    }
+    thunks_condition.notify_all();
     dispatcher.join();
   }
 }
@@ -55,6 +63,11 @@ TaskQueue::~TaskQueue() { stopAndJoin(); }
 
 bool TaskQueue::exhausted() const noexcept { return thunks.empty(); }
 
+auto TaskQueue::getDispatcherCpuTime() const noexcept -> std::chrono::nanoseconds
+{
+  return dispatcher_cpu_time.load(std::memory_order_relaxed);
+}
+
 void TaskQueue::rethrow() const
 {
   if (is_thrown.load(std::memory_order_acquire)) {
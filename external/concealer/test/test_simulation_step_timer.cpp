@@ -0,0 +1,81 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <concealer/simulation_step_timer.hpp>
+#include <vector>
+
+namespace
+{
+/// @note Returns the indices of the steps at which the timer is due.
+auto dueSteps(
+  const std::chrono::nanoseconds & period, const std::chrono::nanoseconds & step_time,
+  const int number_of_steps) -> std::vector<int>
+{
+  auto timer = concealer::SimulationStepTimer(period);
+  auto due_steps = std::vector<int>();
+  for (int step = 0; step < number_of_steps; ++step) {
+    if (timer.isDue(rclcpp::Time(100, 0, RCL_ROS_TIME) + rclcpp::Duration(step * step_time))) {
+      due_steps.push_back(step);
+    }
+  }
+  return due_steps;
+}
+}  // namespace
+
+TEST(SimulationStepTimer, dueAtFirstStep)
+{
+  auto timer = concealer::SimulationStepTimer(std::chrono::milliseconds(20));
+  EXPECT_TRUE(timer.isDue(rclcpp::Time(100, 0, RCL_ROS_TIME)));
+  EXPECT_FALSE(timer.isDue(rclcpp::Time(100, 0, RCL_ROS_TIME)));
+}
+
+TEST(SimulationStepTimer, stepShorterThanPeriod)
+{
+  using std::chrono::milliseconds;
+  EXPECT_EQ(dueSteps(milliseconds(20), milliseconds(5), 10), (std::vector<int>{0, 4, 8}));
+}
+
+/// @note The phase is kept, so a period that is not a multiple of the step does not drift.
+TEST(SimulationStepTimer, stepNotDividingPeriod)
+{
+  using std::chrono::milliseconds;
+  EXPECT_EQ(dueSteps(milliseconds(33), milliseconds(10), 10), (std::vector<int>{0, 4, 7}));
+}
+
+TEST(SimulationStepTimer, stepEqualToPeriod)
+{
+  using std::chrono::milliseconds;
+  EXPECT_EQ(dueSteps(milliseconds(20), milliseconds(20), 4), (std::vector<int>{0, 1, 2, 3}));
+}
+
+/// @note Periods elapsed within a long step are reported once, without catching up afterwards.
+TEST(SimulationStepTimer, stepLongerThanPeriod)
+{
+  using std::chrono::milliseconds;
+  EXPECT_EQ(dueSteps(milliseconds(20), milliseconds(50), 4), (std::vector<int>{0, 1, 2, 3}));
+  auto timer = concealer::SimulationStepTimer(milliseconds(20));
+  EXPECT_TRUE(timer.isDue(rclcpp::Time(100, 0, RCL_ROS_TIME)));
+  EXPECT_TRUE(timer.isDue(rclcpp::Time(100, 100'000'000, RCL_ROS_TIME)));
+  EXPECT_FALSE(timer.isDue(rclcpp::Time(100, 110'000'000, RCL_ROS_TIME)));
+  EXPECT_TRUE(timer.isDue(rclcpp::Time(100, 120'000'000, RCL_ROS_TIME)));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,157 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__CONTEXT_PATCH_HPP_
+#define OPENSCENARIO_INTERPRETER__CONTEXT_PATCH_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace openscenario_interpreter
+{
+/* ---- Context Patch ----------------------------------------------------------
+ *
+ *  Bookkeeping to publish the context as JSON Patch (RFC 6902) without
+ *  serializing the whole scenario every frame.
+ *
+ *  While tracking is enabled, each element serialized into a full snapshot
+ *  registers the JSON pointer to itself and a function writing its values
+ *  that change during the simulation (state, current value, evaluation).
+ *  Elements touch themselves when those values may have changed, and the
+ *  patch is built from the touched elements only.
+ *
+ *  The Interpreter owns the ContextPatch of the scenario it runs, and each
+ *  element refers to it through the OpenScenario it belongs to.
+ *
+ * -------------------------------------------------------------------------- */
+class ContextPatch
+{
+  struct Entry
+  {
+    nlohmann::json::json_pointer pointer;
+
+    std::function<void(nlohmann::json &)> write;
+
+    nlohmann::json published;
+  };
+
+  bool enabled;
+
+  nlohmann::json::json_pointer current_pointer;
+
+  std::unordered_map<const void *, Entry> entries;
+
+  std::unordered_set<const void *> touched_elements;
+
+public:
+  /**
+   * @brief Appends tokens to the JSON pointer of the element being serialized while this object is
+   * alive. A null ContextPatch is accepted for elements that are not tracked.
+   */
+  class Descend
+  {
+    ContextPatch * const context_patch;
+
+    const std::size_t size;
+
+  public:
+    template <typename... Tokens>
+    explicit Descend(ContextPatch & context_patch, Tokens &&... tokens)
+    : Descend(&context_patch, std::forward<decltype(tokens)>(tokens)...)
+    {
+    }
+
+    template <typename... Tokens>
+    explicit Descend(ContextPatch * context_patch, Tokens &&... tokens)
+    : context_patch(context_patch and context_patch->enabled ? context_patch : nullptr),
+      size(this->context_patch ? sizeof...(Tokens) : 0)
+    {
+      if (this->context_patch) {
+        (this->context_patch->current_pointer /= ... /= std::forward<decltype(tokens)>(tokens));
+      }
+    }
+
+    ~Descend()
+    {
+      for (std::size_t i = 0; i < size; ++i) {
+        context_patch->current_pointer.pop_back();
+      }
+    }
+  };
+
+  explicit ContextPatch(bool enabled = false) : enabled(enabled) {}
+
+  ContextPatch(const ContextPatch &) = delete;
+
+  ContextPatch(ContextPatch &&) = delete;
+
+  /**
+   * @brief Enable or disable tracking. Changing it forgets all the elements.
+   */
+  auto enable(bool) -> void;
+
+  /**
+   * @brief Whether elements were registered by a full snapshot, so that a patch can be made.
+   */
+  auto tracking() const noexcept -> bool { return not entries.empty(); }
+
+  /**
+   * @brief Write the values of the element that change during the simulation into the snapshot, and
+   * register the element to be patched later if tracking is enabled.
+   */
+  template <typename Write>
+  auto track(const void * element, nlohmann::json & json, Write && write) -> void
+  {
+    if (enabled) {
+      auto & entry = entries[element];
+      entry.pointer = current_pointer;
+      entry.write = write;
+      entry.published = nlohmann::json::object();
+      write(entry.published);
+      json.update(entry.published);
+    } else {
+      write(json);
+    }
+  }
+
+  auto touch(const void * element) -> void
+  {
+    if (enabled) {
+      touched_elements.insert(element);
+    }
+  }
+
+  /**
+   * @brief Make a JSON Patch of the values of the touched elements that differ from the ones
+   * published last.
+   */
+  auto makePatch() -> nlohmann::json;
+
+  /**
+   * @brief Forget the touched elements, which is required after publishing a full snapshot.
+   */
+  auto untouch() -> void { touched_elements.clear(); }
+
+  /**
+   * @brief Forget all the elements, which is required before the tracked scenario is destroyed.
+   */
+  auto clear() -> void;
+};
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__CONTEXT_PATCH_HPP_
@@ -21,6 +21,7 @@
 #include <lifecycle_msgs/msg/transition.hpp>
 #include <memory>
 #include <openscenario_interpreter/console/escape_sequence.hpp>
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/simulator_core.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
@@ -52,16 +53,34 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode,
 
   const rclcpp_lifecycle::LifecyclePublisher<Context>::SharedPtr publisher_of_context;
 
+  String context_publish_mode;
+
+  double context_publish_rate;
+
+  int context_snapshot_interval;
+
+  int context_publications_since_snapshot = 0;
+
+  std::chrono::steady_clock::time_point last_context_publication_time;
+
   double local_frame_rate;
 
   double local_real_time_factor;
 
+  int npc_logic_update_threads;
+
   String osc_path;
 
   String output_directory;
 
+  bool pipelined_frame_update;
+
   bool record;
 
+  bool send_entity_status_delta;
+
+  ContextPatch context_patch;  // NOTE: must outlive the script that refers to it.
+
   std::shared_ptr<OpenScenario> script;
 
   std::list<std::shared_ptr<ScenarioDefinition>> scenarios;
@@ -108,7 +127,7 @@ public:
 
   auto on_shutdown(const rclcpp_lifecycle::State &) -> Result override;
 
-  auto publishCurrentContext() const -> void;
+  auto publishCurrentContext(const bool force = false) -> void;
 
   auto reset() -> void;
 
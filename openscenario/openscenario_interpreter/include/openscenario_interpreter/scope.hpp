@@ -143,6 +143,8 @@ private:
   auto outermostFrame() const noexcept -> const EnvironmentFrame &;
 };
 
+class ContextPatch;
+
 inline namespace syntax
 {
 struct Entities;
@@ -204,6 +206,8 @@ public:
 
   explicit Scope(const std::string &, const Scope &);
 
+  auto contextPatch() const -> ContextPatch &;
+
   auto dirname() const -> std::string;
 
   template <typename... Ts>
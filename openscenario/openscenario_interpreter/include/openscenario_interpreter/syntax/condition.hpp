@@ -57,6 +57,8 @@ struct Condition : public ComplexType, private SimulatorCore::ConditionEvaluatio
 
   bool current_value;
 
+  ContextPatch & context_patch;
+
 private:
   struct History
   {
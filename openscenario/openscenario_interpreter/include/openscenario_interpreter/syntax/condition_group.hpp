@@ -41,9 +41,17 @@ struct ConditionGroup : public std::list<Condition>
 {
   bool current_value;
 
+  // NOTE: Default constructed ConditionGroup is not tracked.
+  ContextPatch * context_patch = nullptr;
+
   // NOTE: Default constructed ConditionGroup must be return TRUE.
   ConditionGroup() = default;
 
+  explicit ConditionGroup(ContextPatch & context_patch)
+  : current_value(false), context_patch(&context_patch)
+  {
+  }
+
   explicit ConditionGroup(const pugi::xml_node &, Scope &);
 
   auto evaluate() -> Object;
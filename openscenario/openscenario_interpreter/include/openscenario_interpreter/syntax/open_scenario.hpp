@@ -38,6 +38,8 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct OpenScenario : public Scope
 {
+  ContextPatch & context_patch;  // NOTE: must be initialized before any element is read.
+
   const boost::filesystem::path pathname;  // for substitution syntax '$(dirname)'
 
   pugi::xml_document script;
@@ -48,7 +50,7 @@ struct OpenScenario : public Scope
 
   std::size_t frame = 0;
 
-  explicit OpenScenario(const boost::filesystem::path &);
+  explicit OpenScenario(const boost::filesystem::path &, ContextPatch &);
 
   auto evaluate() -> Object;
 
@@ -38,6 +38,8 @@ struct ParameterModifyAction : Scope
 
   const ModifyRule rule;
 
+  const Object parameter;
+
   explicit ParameterModifyAction(const pugi::xml_node &, Scope &, const String &);
 
   static auto accomplished() noexcept -> bool;
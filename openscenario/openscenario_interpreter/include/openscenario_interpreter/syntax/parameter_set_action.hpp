@@ -36,13 +36,15 @@ struct ParameterSetAction : private Scope
 
   const String value;
 
+  const Object parameter;
+
   explicit ParameterSetAction(const pugi::xml_node &, Scope &, const String &);
 
   static auto accomplished() noexcept -> bool;
 
   static auto run() noexcept -> void;
 
-  static auto set(const Scope & scope, const String &, const String &) -> void;
+  static auto set(const Object & parameter, const String &) -> void;
 
   /*  */ auto start() const -> void;
 };
@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/simulator_core.hpp>
@@ -53,28 +54,35 @@ private:
     StoryboardElementState::value_type, std::vector<std::function<void(const StoryboardElement &)>>>
     callbacks;
 
+  ContextPatch & context_patch;
+
 public:
   // Storyboard
-  explicit StoryboardElement(const Trigger & stop_trigger)  //
-  : stop_trigger(stop_trigger)
+  explicit StoryboardElement(ContextPatch & context_patch, const Trigger & stop_trigger)
+  : stop_trigger(stop_trigger), context_patch(context_patch)
   {
   }
 
   // Act
-  explicit StoryboardElement(const Trigger & start_trigger, const Trigger & stop_trigger)
-  : stop_trigger(stop_trigger), start_trigger(start_trigger)
+  explicit StoryboardElement(
+    ContextPatch & context_patch, const Trigger & start_trigger, const Trigger & stop_trigger)
+  : stop_trigger(stop_trigger), start_trigger(start_trigger), context_patch(context_patch)
   {
   }
 
   // Event
   explicit StoryboardElement(
-    const std::size_t maximum_execution_count, const Trigger & start_trigger)
-  : maximum_execution_count(maximum_execution_count), start_trigger(start_trigger)
+    ContextPatch & context_patch, const std::size_t maximum_execution_count,
+    const Trigger & start_trigger)
+  : maximum_execution_count(maximum_execution_count),
+    start_trigger(start_trigger),
+    context_patch(context_patch)
   {
   }
 
-  explicit StoryboardElement(const std::size_t maximum_execution_count = 1)
-  : maximum_execution_count(maximum_execution_count)
+  explicit StoryboardElement(
+    ContextPatch & context_patch, const std::size_t maximum_execution_count = 1)
+  : maximum_execution_count(maximum_execution_count), context_patch(context_patch)
   {
   }
 
@@ -178,6 +186,7 @@ public:
 
   auto transitionTo(const Object & state) -> bool
   {
+    context_patch.touch(this);
     current_state = state;
     for (auto && callback : callbacks[current_state.as<StoryboardElementState>()]) {
       callback(std::as_const(*this));
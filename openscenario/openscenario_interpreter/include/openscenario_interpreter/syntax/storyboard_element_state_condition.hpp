@@ -24,6 +24,8 @@ namespace openscenario_interpreter
 {
 inline namespace syntax
 {
+struct StoryboardElement;
+
 /* ---- StoryboardElementStateCondition ----------------------------------------
  *
  *  <xsd:complexType name="StoryboardElementStateCondition">
@@ -43,6 +45,9 @@ struct StoryboardElementStateCondition : private Scope
 
   StoryboardElementState current_state;
 
+  /// @note Bound after the whole Storyboard is read, because the element may be defined later.
+  const StoryboardElement * storyboard_element = nullptr;
+
   explicit StoryboardElementStateCondition(const pugi::xml_node &, const Scope &);
 
   auto description() const -> String;
@@ -17,6 +17,7 @@
 
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/string.hpp>
+#include <openscenario_interpreter/syntax/traffic_signal_controller.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -45,6 +46,8 @@ struct TrafficSignalControllerAction : public Scope
   */
   const String phase;
 
+  TrafficSignalController & traffic_signal_controller;
+
   explicit TrafficSignalControllerAction(const pugi::xml_node &, const Scope &);
 
   static auto accomplished() noexcept -> bool;
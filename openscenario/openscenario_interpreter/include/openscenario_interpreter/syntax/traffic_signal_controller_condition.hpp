@@ -47,7 +47,7 @@ struct TrafficSignalControllerCondition
 
   Double current_phase_since;
 
-  Scope scope;
+  const TrafficSignalController & traffic_signal_controller;
 
   explicit TrafficSignalControllerCondition(const pugi::xml_node &, const Scope &);
 
@@ -37,6 +37,9 @@ struct Trigger : public std::list<ConditionGroup>
 {
   bool current_value;
 
+  // NOTE: Default constructed Trigger is not tracked.
+  ContextPatch * context_patch = nullptr;
+
   // NOTE: Default constructed Trigger must be return FALSE.
   Trigger() = default;
 
@@ -47,6 +50,11 @@ struct Trigger : public std::list<ConditionGroup>
   {
   }
 
+  explicit Trigger(const std::list<ConditionGroup> & condition_groups, ContextPatch & context_patch)
+  : std::list<ConditionGroup>(condition_groups), context_patch(&context_patch)
+  {
+  }
+
   auto activeConditionGroupIndex() const -> iterator::difference_type;
 
   auto activeConditionGroupDescription() const -> std::vector<std::pair<std::string, std::string>>;
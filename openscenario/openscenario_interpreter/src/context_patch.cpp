@@ -0,0 +1,59 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <openscenario_interpreter/context_patch.hpp>
+
+namespace openscenario_interpreter
+{
+auto ContextPatch::enable(bool enabled) -> void
+{
+  clear();
+  this->enabled = enabled;
+}
+
+auto ContextPatch::makePatch() -> nlohmann::json
+{
+  auto patch = nlohmann::json::array();
+
+  for (const auto & element : touched_elements) {
+    /// @note Elements not serialized into the snapshot (e.g. stop triggers) are not registered.
+    if (const auto iter = entries.find(element); iter != std::end(entries)) {
+      auto & entry = iter->second;
+      auto values = nlohmann::json::object();
+      entry.write(values);
+      for (const auto & value : values.items()) {
+        if (entry.published[value.key()] != value.value()) {
+          patch.push_back({
+            {"op", "replace"},
+            {"path", (entry.pointer / value.key()).to_string()},
+            {"value", value.value()},
+          });
+        }
+      }
+      entry.published = std::move(values);
+    }
+  }
+
+  touched_elements.clear();
+
+  return patch;
+}
+
+auto ContextPatch::clear() -> void
+{
+  current_pointer = nlohmann::json::json_pointer();
+  entries.clear();
+  touched_elements.clear();
+}
+}  // namespace openscenario_interpreter
@@ -15,6 +15,7 @@
 #define OPENSCENARIO_INTERPRETER_NO_EXTENSION
 
 #include <algorithm>
+#include <iomanip>
 #include <nlohmann/json.hpp>
 #include <openscenario_interpreter/openscenario_interpreter.hpp>
 #include <openscenario_interpreter/record.hpp>
@@ -34,17 +35,29 @@ namespace openscenario_interpreter
 Interpreter::Interpreter(const rclcpp::NodeOptions & options)
 : rclcpp_lifecycle::LifecycleNode("openscenario_interpreter", options),
   publisher_of_context(create_publisher<Context>("context", rclcpp::QoS(1).transient_local())),
+  context_publish_mode("full"),
+  context_publish_rate(0),
+  context_snapshot_interval(30),
   local_frame_rate(30),
   local_real_time_factor(1.0),
+  npc_logic_update_threads(1),
   osc_path(""),
   output_directory("/tmp"),
-  record(false)
+  pipelined_frame_update(false),
+  record(false),
+  send_entity_status_delta(false)
 {
+  DECLARE_PARAMETER(context_publish_mode);
+  DECLARE_PARAMETER(context_publish_rate);
+  DECLARE_PARAMETER(context_snapshot_interval);
   DECLARE_PARAMETER(local_frame_rate);
   DECLARE_PARAMETER(local_real_time_factor);
+  DECLARE_PARAMETER(npc_logic_update_threads);
   DECLARE_PARAMETER(osc_path);
   DECLARE_PARAMETER(output_directory);
+  DECLARE_PARAMETER(pipelined_frame_update);
   DECLARE_PARAMETER(record);
+  DECLARE_PARAMETER(send_entity_status_delta);
 }
 
 Interpreter::~Interpreter() {}
@@ -67,7 +80,10 @@ auto Interpreter::makeCurrentConfiguration() const -> traffic_simulator::Configu
     logic_file.isDirectory() ? logic_file : logic_file.filepath.parent_path());
   {
     configuration.auto_sink = false;
+    configuration.npc_logic_update_threads = std::max(npc_logic_update_threads, 1);
+    configuration.pipelined_frame_update = pipelined_frame_update;
     configuration.scenario_path = osc_path;
+    configuration.send_entity_status_delta = send_entity_status_delta;
 
     // XXX DIRTY HACK!!!
     if (not logic_file.isDirectory() and logic_file.filepath.extension() == ".osm") {
@@ -98,13 +114,29 @@ auto Interpreter::on_configure(const rclcpp_lifecycle::State &) -> Result
 
       std::this_thread::sleep_for(std::chrono::seconds(1));  // NOTE: Wait for parameters to be set.
 
+      GET_PARAMETER(context_publish_mode);
+      GET_PARAMETER(context_publish_rate);
+      GET_PARAMETER(context_snapshot_interval);
       GET_PARAMETER(local_frame_rate);
       GET_PARAMETER(local_real_time_factor);
+      GET_PARAMETER(npc_logic_update_threads);
       GET_PARAMETER(osc_path);
       GET_PARAMETER(output_directory);
+      GET_PARAMETER(pipelined_frame_update);
       GET_PARAMETER(record);
+      GET_PARAMETER(send_entity_status_delta);
 
-      script = std::make_shared<OpenScenario>(osc_path);
+      if (
+        context_publish_mode != "full" and context_publish_mode != "delta" and
+        context_publish_mode != "none") {
+        throw Error(
+          "Unsupported context_publish_mode ", std::quoted(context_publish_mode),
+          " was given. Expected \"full\", \"delta\" or \"none\"");
+      }
+
+      context_patch.enable(context_publish_mode == "delta");
+
+      script = std::make_shared<OpenScenario>(osc_path, context_patch);
 
       if (script->category.is<ScenarioDefinition>()) {
         scenarios = {std::dynamic_pointer_cast<ScenarioDefinition>(script->category)};
@@ -163,7 +195,7 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
   auto evaluate_storyboard = [this]() {
     withExceptionHandler(
       [this](auto &&...) {
-        publishCurrentContext();
+        publishCurrentContext(true);
         deactivate();
       },
       [this]() {
@@ -194,7 +226,7 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
   } else {
     return withExceptionHandler(
       [this](auto &&...) {
-        publishCurrentContext();
+        publishCurrentContext(true);
         reset();
         return Interpreter::Result::FAILURE;  // => Inactive
       },
@@ -227,6 +259,8 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
 
         publisher_of_context->on_activate();
 
+        context_patch.clear();
+
         assert(publisher_of_context->is_activated());
 
         if (currentScenarioDefinition()) {
@@ -272,13 +306,43 @@ auto Interpreter::on_shutdown(const rclcpp_lifecycle::State &) -> Result
   return Interpreter::Result::SUCCESS;  // => Finalized
 }
 
-auto Interpreter::publishCurrentContext() const -> void
+auto Interpreter::publishCurrentContext(const bool force) -> void
 {
+  if (context_publish_mode == "none") {
+    return;
+  }
+
+  if (const auto current_time = std::chrono::steady_clock::now();
+      not force and 0 < context_publish_rate and
+      current_time - last_context_publication_time <
+        std::chrono::duration<double>(1 / context_publish_rate)) {
+    return;
+  } else {
+    last_context_publication_time = current_time;
+  }
+
   Context context;
   {
-    nlohmann::json json;
     context.stamp = now();
-    context.data = (json << *script).dump();
+    /**
+     * @note In delta mode, one in context_snapshot_interval publications is a full snapshot so
+     * that subscribers that joined late or lost a message can recover. The first publication
+     * after activation is always a snapshot, which registers the elements to be patched.
+     */
+    if (
+      context_publish_mode == "delta" and not force and context_patch.tracking() and
+      ++context_publications_since_snapshot < context_snapshot_interval) {
+      /// @note The delta is a JSON Patch (RFC 6902) to the previous message, so it is an array
+      /// while a full snapshot is an object. It is made only of the elements touched since the
+      /// previous message, without serializing the whole scenario.
+      context_patch.touch(script.get());
+      context.data = context_patch.makePatch().dump();
+    } else {
+      nlohmann::json json;
+      context.data = (json << *script).dump();
+      context_patch.untouch();
+      context_publications_since_snapshot = 0;
+    }
     context.time = evaluateSimulationTime();
   }
 
@@ -295,6 +359,8 @@ auto Interpreter::reset() -> void
 
   SimulatorCore::deactivate();
 
+  context_patch.clear();
+
   scenarios.pop_front();
 
   // NOTE: Error on simulation is not error of the interpreter; so we print error messages into
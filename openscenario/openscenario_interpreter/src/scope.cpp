@@ -104,6 +104,12 @@ Scope::Scope(const std::string & name, const Scope & outer)
 {
 }
 
+auto Scope::contextPatch() const -> ContextPatch &
+{
+  assert(open_scenario);
+  return open_scenario->context_patch;
+}
+
 auto Scope::dirname() const -> std::string
 {
   assert(open_scenario);
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/act.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
@@ -24,7 +25,7 @@ inline namespace syntax
 Act::Act(const pugi::xml_node & node, Scope & scope)
 : Scope(readAttribute<String>("name", node, scope), scope),
   StoryboardElement(
-    readElement<Trigger>("StartTrigger", node, local()),
+    contextPatch(), readElement<Trigger>("StartTrigger", node, local()),
     readElement<Trigger>("StopTrigger", node, local()))  // NOTE: Optional element
 {
   traverse<1, unbounded>(node, "ManeuverGroup", [&](auto && node) {
@@ -50,12 +51,17 @@ auto operator<<(nlohmann::json & json, const Act & datum) -> nlohmann::json &
 {
   json["name"] = datum.name;
 
-  json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+  datum.contextPatch().track(
+    static_cast<const StoryboardElement *>(&datum), json, [&datum](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+    });
 
   json["ManeuverGroup"] = nlohmann::json::array();
 
   for (auto && maneuver_group : datum.elements) {
     nlohmann::json act;
+    const ContextPatch::Descend descend(
+      datum.contextPatch(), "ManeuverGroup", json["ManeuverGroup"].size());
     act << maneuver_group.as<ManeuverGroup>();
     json["ManeuverGroup"].push_back(act);
   }
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/action.hpp>
 #include <openscenario_interpreter/utility/demangle.hpp>
@@ -27,7 +28,8 @@ Action::Action(const pugi::xml_node & node, Scope & scope)
     choice(node,
       std::make_pair(     "GlobalAction", [this](auto && node) { return make<     GlobalAction>(node, local()); }),
       std::make_pair("UserDefinedAction", [this](auto && node) { return make<UserDefinedAction>(node, local()); }),
-      std::make_pair(    "PrivateAction", [this](auto && node) { return make<    PrivateAction>(node, local()); })))
+      std::make_pair(    "PrivateAction", [this](auto && node) { return make<    PrivateAction>(node, local()); }))),
+  StoryboardElement(contextPatch())
 // clang-format on
 {
 }
@@ -62,7 +64,10 @@ auto operator<<(nlohmann::json & json, const Action & datum) -> nlohmann::json &
 {
   json["name"] = datum.name;
 
-  json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+  datum.contextPatch().track(
+    static_cast<const StoryboardElement *>(&datum), json, [&datum](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+    });
 
   json["type"] =
     apply<std::string>([](auto && action) { return makeTypename(action.type()); }, datum);
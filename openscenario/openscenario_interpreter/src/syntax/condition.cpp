@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <functional>
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/object.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
@@ -40,13 +41,16 @@ Condition::Condition(const pugi::xml_node & node, Scope & scope)
   name(readAttribute<String>("name", node, scope)),
   delay(readAttribute<Double>("delay", node, scope, Double())),
   condition_edge(readAttribute<ConditionEdge>("conditionEdge", node, scope)),
-  current_value(false)
+  current_value(false),
+  context_patch(scope.contextPatch())
 // clang-format on
 {
 }
 
 auto Condition::evaluate() -> Object
 {
+  context_patch.touch(this);
+
   switch (condition_edge) {
     case ConditionEdge::rising:
       return update_condition(std::function([](bool a, bool b) { return a and not b; }));
@@ -70,9 +74,10 @@ auto Condition::evaluate() -> Object
 
 auto operator<<(nlohmann::json & json, const Condition & datum) -> nlohmann::json &
 {
-  json["currentEvaluation"] = datum.description();
-
-  json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
+  datum.context_patch.track(&datum, json, [&datum](nlohmann::json & json) {
+    json["currentEvaluation"] = datum.description();
+    json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
+  });
 
   json["name"] = datum.name;
 
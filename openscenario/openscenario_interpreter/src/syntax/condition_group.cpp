@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/condition_group.hpp>
 
@@ -19,13 +20,18 @@ namespace openscenario_interpreter
 {
 inline namespace syntax
 {
-ConditionGroup::ConditionGroup(const pugi::xml_node & node, Scope & scope) : current_value(false)
+ConditionGroup::ConditionGroup(const pugi::xml_node & node, Scope & scope)
+: current_value(false), context_patch(&scope.contextPatch())
 {
   traverse<1, unbounded>(node, "Condition", [&](auto && node) { emplace_back(node, scope); });
 }
 
 auto ConditionGroup::evaluate() -> Object
 {
+  if (context_patch) {
+    context_patch->touch(this);
+  }
+
   // NOTE: Don't use std::all_of; Intentionally does not short-circuit evaluation.
   return asBoolean(
     current_value = std::accumulate(
@@ -37,12 +43,21 @@ auto ConditionGroup::evaluate() -> Object
 
 auto operator<<(nlohmann::json & json, const ConditionGroup & datum) -> nlohmann::json &
 {
-  json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
+  const auto write = [&datum](nlohmann::json & json) {
+    json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
+  };
+
+  if (datum.context_patch) {
+    datum.context_patch->track(&datum, json, write);
+  } else {
+    write(json);
+  }
 
   json["Condition"] = nlohmann::json::array();
 
   for (const auto & each : datum) {
     nlohmann::json condition;
+    const ContextPatch::Descend descend(datum.context_patch, "Condition", json["Condition"].size());
     condition << each;
     json["Condition"].push_back(condition);
   }
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
@@ -24,9 +25,12 @@ inline namespace syntax
 Event::Event(const pugi::xml_node & node, Scope & scope, Maneuver & maneuver)
 : Scope(readAttribute<String>("name", node, scope), scope),
   StoryboardElement(
+    contextPatch(),
     readAttribute<UnsignedInt>("maximumExecutionCount", node, local(), UnsignedInt(1)),
     // If there is no "StartTrigger" in the "Event", the default StartTrigger that always returns true is used.
-    readElement<Trigger>("StartTrigger", node, local(), Trigger({ConditionGroup()}))),
+    readElement<Trigger>(
+      "StartTrigger", node, local(),
+      Trigger({ConditionGroup(contextPatch())}, contextPatch()))),
   priority(readAttribute<Priority>("priority", node, local())),
   parent_maneuver(maneuver)
 {
@@ -71,19 +75,24 @@ auto operator<<(nlohmann::json & json, const Event & datum) -> nlohmann::json &
 {
   json["name"] = datum.name;
 
-  json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+  datum.contextPatch().track(
+    static_cast<const StoryboardElement *>(&datum), json, [&datum](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+      json["currentExecutionCount"] = datum.current_execution_count;
+    });
 
-  json["currentExecutionCount"] = datum.current_execution_count;
   json["maximumExecutionCount"] = datum.maximum_execution_count;
 
   json["Action"] = nlohmann::json::array();
 
   for (const auto & each : datum.elements) {
     nlohmann::json action;
+    const ContextPatch::Descend descend(datum.contextPatch(), "Action", json["Action"].size());
     action << each.as<Action>();
     json["Action"].push_back(action);
   }
 
+  const ContextPatch::Descend descend(datum.contextPatch(), "StartTrigger");
   json["StartTrigger"] << datum.start_trigger;
 
   return json;
@@ -25,6 +25,7 @@ namespace openscenario_interpreter
 inline namespace syntax
 {
 InitActions::InitActions(const pugi::xml_node & node, Scope & scope)
+: StoryboardElement(scope.contextPatch())
 {
   std::unordered_map<std::string, std::function<void(const pugi::xml_node & node)>> dispatcher{
     // clang-format off
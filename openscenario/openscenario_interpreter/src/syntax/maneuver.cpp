@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
 #include <openscenario_interpreter/syntax/event.hpp>
@@ -23,6 +24,7 @@ inline namespace syntax
 {
 Maneuver::Maneuver(const pugi::xml_node & node, Scope & scope)
 : Scope(readAttribute<String>("name", node, scope), scope),
+  StoryboardElement(contextPatch()),
   parameter_declarations(readElement<ParameterDeclarations>("ParameterDeclarations", node, local()))
 {
   traverse<1, unbounded>(node, "Event", [&](auto && node) {
@@ -68,12 +70,16 @@ auto operator<<(nlohmann::json & json, const Maneuver & maneuver) -> nlohmann::j
 {
   json["name"] = maneuver.name;
 
-  json["currentState"] = boost::lexical_cast<std::string>(maneuver.state());
+  maneuver.contextPatch().track(
+    static_cast<const StoryboardElement *>(&maneuver), json, [&maneuver](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(maneuver.state());
+    });
 
   json["Event"] = nlohmann::json::array();
 
   for (const auto & event : maneuver.elements) {
     nlohmann::json json_event;
+    const ContextPatch::Descend descend(maneuver.contextPatch(), "Event", json["Event"].size());
     json_event << event.as<Event>();
     json["Event"].push_back(json_event);
   }
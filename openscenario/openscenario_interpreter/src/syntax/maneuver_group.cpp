@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
@@ -24,6 +25,7 @@ inline namespace syntax
 ManeuverGroup::ManeuverGroup(const pugi::xml_node & node, Scope & scope)
 : Scope(readAttribute<String>("name", node, scope), scope),
   StoryboardElement(
+    contextPatch(),
     readAttribute<UnsignedInteger>("maximumExecutionCount", node, local(), UnsignedInteger())),
   actors(readElement<Actors>("Actors", node, local()))
 {
@@ -63,15 +65,21 @@ auto operator<<(nlohmann::json & json, const ManeuverGroup & maneuver_group) ->
 {
   json["name"] = maneuver_group.name;
 
-  json["currentState"] = boost::lexical_cast<std::string>(maneuver_group.state());
+  maneuver_group.contextPatch().track(
+    static_cast<const StoryboardElement *>(&maneuver_group), json,
+    [&maneuver_group](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(maneuver_group.state());
+      json["currentExecutionCount"] = maneuver_group.current_execution_count;
+    });
 
-  json["currentExecutionCount"] = maneuver_group.current_execution_count;
   json["maximumExecutionCount"] = maneuver_group.maximum_execution_count;
 
   json["Maneuver"] = nlohmann::json::array();
 
   for (auto && maneuver : maneuver_group.elements) {
     nlohmann::json json_maneuver;
+    const ContextPatch::Descend descend(
+      maneuver_group.contextPatch(), "Maneuver", json["Maneuver"].size());
     json_maneuver << maneuver.as<Maneuver>();
     json["Maneuver"].push_back(json_maneuver);
   }
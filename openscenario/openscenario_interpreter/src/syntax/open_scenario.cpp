@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/open_scenario_category.hpp>
@@ -21,8 +22,9 @@ namespace openscenario_interpreter
 {
 inline namespace syntax
 {
-OpenScenario::OpenScenario(const boost::filesystem::path & pathname)
+OpenScenario::OpenScenario(const boost::filesystem::path & pathname, ContextPatch & context_patch)
 : Scope(this),
+  context_patch(context_patch),
   pathname(pathname),
   file_header(readElement<FileHeader>("FileHeader", load(pathname).child("OpenSCENARIO"), local())),
   category(readElement<OpenScenarioCategory>("OpenSCENARIO", script, local()))
@@ -48,17 +50,20 @@ auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::
 {
   json["version"] = "1.0";
 
-  json["frame"] = datum.frame;
+  datum.context_patch.track(&datum, json, [&datum](nlohmann::json & json) {
+    json["frame"] = datum.frame;
 
-  // clang-format off
-  json["CurrentStates"]["completeState"]   = openscenario_interpreter::complete_state  .use_count() - 1;
-  json["CurrentStates"]["runningState"]    = openscenario_interpreter::running_state   .use_count() - 1;
-  json["CurrentStates"]["standbyState"]    = openscenario_interpreter::standby_state   .use_count() - 1;
-  json["CurrentStates"]["startTransition"] = openscenario_interpreter::start_transition.use_count() - 1;
-  json["CurrentStates"]["stopTransition"]  = openscenario_interpreter::stop_transition .use_count() - 1;
-  // clang-format on
+    // clang-format off
+    json["CurrentStates"]["completeState"]   = openscenario_interpreter::complete_state  .use_count() - 1;
+    json["CurrentStates"]["runningState"]    = openscenario_interpreter::running_state   .use_count() - 1;
+    json["CurrentStates"]["standbyState"]    = openscenario_interpreter::standby_state   .use_count() - 1;
+    json["CurrentStates"]["startTransition"] = openscenario_interpreter::start_transition.use_count() - 1;
+    json["CurrentStates"]["stopTransition"]  = openscenario_interpreter::stop_transition .use_count() - 1;
+    // clang-format on
+  });
 
   if (datum.category.is<ScenarioDefinition>()) {
+    const ContextPatch::Descend descend(datum.context_patch, "OpenSCENARIO");
     json["OpenSCENARIO"] << datum.category.as<ScenarioDefinition>();
   }
 
@@ -28,7 +28,8 @@ ParameterCondition::ParameterCondition(const pugi::xml_node & node, Scope & scop
 : Scope(scope),
   parameter_ref(readAttribute<String>("parameterRef", node, local())),
   value(readAttribute<String>("value", node, local())),
-  rule(readAttribute<Rule>("rule", node, local()))
+  rule(readAttribute<Rule>("rule", node, local())),
+  parameter(local().ref(parameter_ref))
 {
 }
 
@@ -63,23 +64,14 @@ auto ParameterCondition::description() const -> String
   std::stringstream description;
 
   description << "The value of parameter " << std::quoted(parameter_ref) << " = "
-              << local().ref(parameter_ref) << " " << rule << " " << value << "?";
+              << parameter << " " << rule << " " << value << "?";
 
   return description.str();
 }
 
 auto ParameterCondition::evaluate() const -> Object
 {
-  try {
-    const auto parameter = local().ref(parameter_ref);
-    if (not parameter) {
-      THROW_SYNTAX_ERROR(parameter_ref, " cannot be found from this scope");
-    } else {
-      return asBoolean(compare(parameter, rule, value));
-    }
-  } catch (const std::out_of_range &) {
-    throw SemanticError("No such parameter ", std::quoted(parameter_ref));
-  }
+  return asBoolean(compare(parameter, rule, value));
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
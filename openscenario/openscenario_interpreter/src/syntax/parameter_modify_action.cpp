@@ -23,7 +23,10 @@ inline namespace syntax
 {
 ParameterModifyAction::ParameterModifyAction(
   const pugi::xml_node & node, Scope & scope, const String & parameter_ref)
-: Scope(scope), parameter_ref(parameter_ref), rule(readElement<ModifyRule>("Rule", node, local()))
+: Scope(scope),
+  parameter_ref(parameter_ref),
+  rule(readElement<ModifyRule>("Rule", node, local())),
+  parameter(local().ref(parameter_ref))
 {
 }
 
@@ -33,15 +36,10 @@ auto ParameterModifyAction::run() noexcept -> void {}
 
 auto ParameterModifyAction::start() const -> void
 {
-  try {
-    const auto target = local().ref(parameter_ref);
-    if (rule.is<ParameterAddValueRule>()) {
-      rule.as<ParameterAddValueRule>()(target);
-    } else {
-      rule.as<ParameterMultiplyByValueRule>()(target);
-    }
-  } catch (const std::out_of_range &) {
-    throw SemanticError("No such parameter ", std::quoted(parameter_ref));
+  if (rule.is<ParameterAddValueRule>()) {
+    rule.as<ParameterAddValueRule>()(parameter);
+  } else {
+    rule.as<ParameterMultiplyByValueRule>()(parameter);
   }
 }
 }  // namespace syntax
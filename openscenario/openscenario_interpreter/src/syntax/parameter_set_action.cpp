@@ -23,7 +23,10 @@ inline namespace syntax
 {
 ParameterSetAction::ParameterSetAction(
   const pugi::xml_node & node, Scope & scope, const String & parameter_ref)
-: Scope(scope), parameter_ref(parameter_ref), value(readAttribute<String>("value", node, local()))
+: Scope(scope),
+  parameter_ref(parameter_ref),
+  value(readAttribute<String>("value", node, local())),
+  parameter(local().ref(parameter_ref))
 {
 }
 
@@ -34,8 +37,7 @@ auto ParameterSetAction::accomplished() noexcept -> bool  //
 
 auto ParameterSetAction::run() noexcept -> void {}
 
-auto ParameterSetAction::set(
-  const Scope & scope, const String & parameter_ref, const String & value) -> void
+auto ParameterSetAction::set(const Object & parameter, const String & value) -> void
 {
   static const std::unordered_map<
     std::type_index, std::function<void(const Object &, const String &)>>
@@ -50,14 +52,12 @@ auto ParameterSetAction::set(
       // clang-format on
     };
 
-  const auto parameter = scope.ref(parameter_ref);
-
   overloads.at(parameter.type())(parameter, value);
 }
 
 auto ParameterSetAction::start() const -> void  //
 {
-  set(local(), parameter_ref, value);
+  set(parameter, value);
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
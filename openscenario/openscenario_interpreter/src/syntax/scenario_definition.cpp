@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
@@ -48,6 +49,7 @@ auto operator<<(std::ostream & os, const ScenarioDefinition & datum) -> std::ost
 
 auto operator<<(nlohmann::json & json, const ScenarioDefinition & datum) -> nlohmann::json &
 {
+  const ContextPatch::Descend descend(datum.storyboard.contextPatch(), "Storyboard");
   json["Storyboard"] << datum.storyboard;
 
   return json;
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/act.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
@@ -24,7 +25,7 @@ namespace openscenario_interpreter
 inline namespace syntax
 {
 Story::Story(const pugi::xml_node & node, Scope & scope)
-: Scope(readAttribute<String>("name", node, scope), scope)
+: Scope(readAttribute<String>("name", node, scope), scope), StoryboardElement(contextPatch())
 {
   traverse<0, 1>(node, "ParameterDeclarations", [&](auto && node) {
     return make<ParameterDeclarations>(node, local());
@@ -53,12 +54,16 @@ auto operator<<(nlohmann::json & json, const Story & story) -> nlohmann::json &
 {
   json["name"] = story.name;
 
-  json["currentState"] = boost::lexical_cast<std::string>(story.state());
+  story.contextPatch().track(
+    static_cast<const StoryboardElement *>(&story), json, [&story](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(story.state());
+    });
 
   json["Act"] = nlohmann::json::array();
 
   for (auto && act : story.elements) {
     nlohmann::json json_act;
+    const ContextPatch::Descend descend(story.contextPatch(), "Act", json["Act"].size());
     json_act << act.as<Act>();
     json["Act"].push_back(json_act);
   }
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/simulator_core.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
@@ -29,7 +30,7 @@ inline namespace syntax
 {
 Storyboard::Storyboard(const pugi::xml_node & node, Scope & scope)
 : Scope("Storyboard", scope),  // FIXME DIRTY HACK
-  StoryboardElement(readElement<Trigger>("StopTrigger", node, local())),
+  StoryboardElement(contextPatch(), readElement<Trigger>("StopTrigger", node, local())),
   init(readElement<Init>("Init", node, local()))
 {
   elements.push_back(make(init.actions));
@@ -60,7 +61,10 @@ auto Storyboard::run() -> void
 
 auto operator<<(nlohmann::json & json, const Storyboard & datum) -> nlohmann::json &
 {
-  json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+  datum.contextPatch().track(
+    static_cast<const StoryboardElement *>(&datum), json, [&datum](nlohmann::json & json) {
+      json["currentState"] = boost::lexical_cast<std::string>(datum.state());
+    });
 
   json["Init"] << datum.init;
 
@@ -71,6 +75,7 @@ auto operator<<(nlohmann::json & json, const Storyboard & datum) -> nlohmann::js
     if (story.is<InitActions>()) {
       continue;
     }
+    const ContextPatch::Descend descend(datum.contextPatch(), "Story", json["Story"].size());
     each << story.as<Story>();
     json["Story"].push_back(each);
   }
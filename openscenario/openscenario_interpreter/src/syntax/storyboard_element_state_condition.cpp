@@ -42,15 +42,15 @@ StoryboardElementStateCondition::StoryboardElementStateCondition(
      transition to the next state after calling the callback function.
   */
 
-  auto register_callback = [this]() {
-    local()
-      .ref<StoryboardElement>(storyboard_element_ref)
-      .addTransitionCallback(state, [this](auto && storyboard_element) {
-        current_state = storyboard_element.state().template as<StoryboardElementState>();
-      });
+  auto bind_and_register_callback = [this]() {
+    auto & element = local().ref<StoryboardElement>(storyboard_element_ref);
+    element.addTransitionCallback(state, [this](auto && storyboard_element) {
+      current_state = storyboard_element.state().template as<StoryboardElementState>();
+    });
+    storyboard_element = &element;
   };
 
-  Storyboard::thunks.push(register_callback);
+  Storyboard::thunks.push(bind_and_register_callback);
 }
 
 auto StoryboardElementStateCondition::description() const -> String
@@ -66,18 +66,14 @@ auto StoryboardElementStateCondition::description() const -> String
 auto StoryboardElementStateCondition::evaluate() -> Object
 {
   auto update = [this]() {
-    auto storyboard_element = [this]() {
-      return local().ref<StoryboardElement>(storyboard_element_ref);
-    };
-    return current_state = storyboard_element().state().template as<StoryboardElementState>();
+    return current_state = storyboard_element->state().template as<StoryboardElementState>();
   };
 
   /*
      Note that current_state may have been updated by a callback function set
      in the constructor (before this member function was called).  And at this
-     point local().ref<StoryboardElement>(storyboard_element_ref).state() may
-     have transitioned to a different state than the one recorded in
-     current_state.
+     point storyboard_element->state() may have transitioned to a different
+     state than the one recorded in current_state.
 
      Therefore, we must first check to see if the callback function has updated
      current_state (= has the StoryboardElement transitioned to the monitored
@@ -23,7 +23,7 @@ TrafficSignalControllerCondition::TrafficSignalControllerCondition(
   const pugi::xml_node & tree, const Scope & scope)
 : phase(readAttribute<String>("phase", tree, scope)),
   traffic_signal_controller_ref(readAttribute<String>("trafficSignalControllerRef", tree, scope)),
-  scope(scope)
+  traffic_signal_controller(scope.ref<TrafficSignalController>(traffic_signal_controller_ref))
 {
 }
 
@@ -42,9 +42,8 @@ auto TrafficSignalControllerCondition::description() const -> String
 
 auto TrafficSignalControllerCondition::evaluate() -> Object
 {
-  const auto & controller = scope.ref<TrafficSignalController>(traffic_signal_controller_ref);
-  current_phase_name = controller.currentPhaseName();
-  current_phase_since = controller.currentPhaseSince();
+  current_phase_name = traffic_signal_controller.currentPhaseName();
+  current_phase_since = traffic_signal_controller.currentPhaseSince();
   return asBoolean(current_phase_name == phase);
 }
 }  // namespace syntax
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/trigger.hpp>
 
@@ -20,6 +21,7 @@ namespace openscenario_interpreter
 inline namespace syntax
 {
 Trigger::Trigger(const pugi::xml_node & node, Scope & scope)
+: context_patch(&scope.contextPatch())
 {
   traverse<0, unbounded>(node, "ConditionGroup", [&](auto && node) { emplace_back(node, scope); });
 }
@@ -35,6 +37,10 @@ auto Trigger::evaluate() -> Object
    *
    * ---------------------------------------------------------------------- */
   // NOTE: Don't use std::any_of; Intentionally does not short-circuit evaluation.
+  if (context_patch) {
+    context_patch->touch(this);
+  }
+
   return asBoolean(
     current_value = std::accumulate(
       std::begin(*this), std::end(*this), false,
@@ -65,12 +71,22 @@ auto Trigger::activeConditionGroupDescription() const
 
 auto operator<<(nlohmann::json & json, const Trigger & datum) -> nlohmann::json &
 {
-  json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
+  const auto write = [&datum](nlohmann::json & json) {
+    json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
+  };
+
+  if (datum.context_patch) {
+    datum.context_patch->track(&datum, json, write);
+  } else {
+    write(json);
+  }
 
   json["ConditionGroup"] = nlohmann::json::array();
 
   for (const auto & each : datum) {
     nlohmann::json condition_group;
+    const ContextPatch::Descend descend(
+      datum.context_patch, "ConditionGroup", json["ConditionGroup"].size());
     condition_group << each;
     json["ConditionGroup"].push_back(condition_group);
   }
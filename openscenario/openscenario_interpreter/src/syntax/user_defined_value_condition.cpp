@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <boost/lexical_cast.hpp>
+#include <chrono>
 #include <openscenario_interpreter/error.hpp>
 #include <openscenario_interpreter/functional/curry.hpp>
 #include <openscenario_interpreter/regex/function_call_expression.hpp>
@@ -21,8 +23,14 @@
 #include <openscenario_interpreter/syntax/parameter_condition.hpp>  // for ParameterCondition::compare
 #include <openscenario_interpreter/syntax/parameter_declaration.hpp>
 #include <openscenario_interpreter/syntax/user_defined_value_condition.hpp>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #if __has_include(<tier4_simulation_msgs/msg/user_defined_value.hpp>)
 #include <tier4_simulation_msgs/msg/user_defined_value.hpp>
@@ -32,48 +40,89 @@ namespace openscenario_interpreter
 {
 inline namespace syntax
 {
+/*
+   Subscriptions of all UserDefinedValueConditions share one node and one
+   executor thread. Each topic is subscribed once, and its latest message is
+   kept in a slot that conditions read without waiting for the executor.
+*/
 template <typename T>
-struct MagicSubscription : private rclcpp::Node, public T
+class MagicSubscription : private rclcpp::Node
 {
-  std::promise<void> promise;
+public:
+  class Slot
+  {
+    std::shared_ptr<const T> latest_message;
 
-  std::thread thread;
+  public:
+    auto load() const { return std::atomic_load(&latest_message); }
 
-  std::exception_ptr thrown;
+    auto store(std::shared_ptr<const T> message) -> void
+    {
+      std::atomic_store(&latest_message, std::move(message));
+    }
+  };
 
-  typename rclcpp::Subscription<T>::SharedPtr subscription;
+  /// @note The node lives as long as some UserDefinedValueCondition uses it.
+  static auto instance() -> std::shared_ptr<MagicSubscription>
+  {
+    static std::mutex instance_mutex;
+    static std::weak_ptr<MagicSubscription> shared;
+    std::lock_guard<std::mutex> lock(instance_mutex);
+    if (auto hub = shared.lock()) {
+      return hub;
+    } else {
+      hub = std::make_shared<MagicSubscription>();
+      shared = hub;
+      return hub;
+    }
+  }
 
-public:
-  explicit MagicSubscription(const std::string & node_name, const std::string & topic_name)
-  : rclcpp::Node(node_name),
-    thread(
-      [this](auto future) {
-        while (rclcpp::ok() and
-               future.wait_for(std::chrono::milliseconds(1)) == std::future_status::timeout) {
-          try {
-            rclcpp::spin_some(get_node_base_interface());
-          } catch (...) {
-            thrown = std::current_exception();
-          }
-        }
-      },
-      std::move(promise.get_future())),
-    subscription(create_subscription<T>(topic_name, 1, [this](const typename T::SharedPtr message) {
-      static_cast<T &>(*this) = *message;
-    }))
+  MagicSubscription() : rclcpp::Node("user_defined_value_subscription")
   {
+    executor.add_node(get_node_base_interface());
+    thread = std::thread([this]() {
+      while (rclcpp::ok() and not stopped) {
+        executor.spin_once(std::chrono::milliseconds(100));
+      }
+    });
   }
 
-  ~MagicSubscription()
+  ~MagicSubscription() override
   {
+    stopped = true;
+    executor.cancel();  // Wake up spin_once.
     if (thread.joinable()) {
-      promise.set_value();
       thread.join();
     }
   }
-};
 
-uint64_t UserDefinedValueCondition::magic_subscription_counter = 0;
+  auto subscribe(const std::string & topic_name) -> std::shared_ptr<const Slot>
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (const auto iter = slots.find(topic_name); iter != std::end(slots)) {
+      return iter->second;
+    } else {
+      auto slot = std::make_shared<Slot>();
+      subscriptions.push_back(create_subscription<T>(
+        topic_name, 1, [slot](typename T::ConstSharedPtr message) { slot->store(message); }));
+      slots.emplace(topic_name, slot);
+      return slot;
+    }
+  }
+
+private:
+  rclcpp::executors::SingleThreadedExecutor executor;
+
+  std::atomic<bool> stopped{false};
+
+  std::thread thread;
+
+  std::mutex mutex;
+
+  std::unordered_map<std::string, std::shared_ptr<Slot>> slots;
+
+  std::vector<typename rclcpp::Subscription<T>::SharedPtr> subscriptions;
+};
 
 UserDefinedValueCondition::UserDefinedValueCondition(const pugi::xml_node & node, Scope & scope)
 : name(readAttribute<String>("name", node, scope)),
@@ -133,33 +182,34 @@ UserDefinedValueCondition::UserDefinedValueCondition(const pugi::xml_node & node
     using tier4_simulation_msgs::msg::UserDefinedValue;
     using tier4_simulation_msgs::msg::UserDefinedValueType;
 
-    evaluate_value =
-      [&, current_message = std::make_shared<MagicSubscription<UserDefinedValue>>(
-            result.str(1) + "_subscription_" + std::to_string(++magic_subscription_counter),
-            result.str(0))]() {
-        auto evaluate = [](const auto & user_defined_value) {
-          switch (user_defined_value.type.data) {
-            case UserDefinedValueType::BOOLEAN:
-              return make<Boolean>(user_defined_value.value);
-            case UserDefinedValueType::DATE_TIME:
-              return make<String>(user_defined_value.value);
-            case UserDefinedValueType::DOUBLE:
-              return make<Double>(user_defined_value.value);
-            case UserDefinedValueType::INTEGER:
-              return make<Integer>(user_defined_value.value);
-            case UserDefinedValueType::STRING:
-              return make<String>(user_defined_value.value);
-            case UserDefinedValueType::UNSIGNED_INT:
-              return make<UnsignedInt>(user_defined_value.value);
-            case UserDefinedValueType::UNSIGNED_SHORT:
-              return make<UnsignedShort>(user_defined_value.value);
-            default:
-              return unspecified;
-          }
-        };
-
-        return not current_message->value.empty() ? evaluate(*current_message) : unspecified;
+    const auto hub = MagicSubscription<UserDefinedValue>::instance();
+
+    evaluate_value = [hub, slot = hub->subscribe(result.str(0))]() {
+      auto evaluate = [](const auto & user_defined_value) {
+        switch (user_defined_value.type.data) {
+          case UserDefinedValueType::BOOLEAN:
+            return make<Boolean>(user_defined_value.value);
+          case UserDefinedValueType::DATE_TIME:
+            return make<String>(user_defined_value.value);
+          case UserDefinedValueType::DOUBLE:
+            return make<Double>(user_defined_value.value);
+          case UserDefinedValueType::INTEGER:
+            return make<Integer>(user_defined_value.value);
+          case UserDefinedValueType::STRING:
+            return make<String>(user_defined_value.value);
+          case UserDefinedValueType::UNSIGNED_INT:
+            return make<UnsignedInt>(user_defined_value.value);
+          case UserDefinedValueType::UNSIGNED_SHORT:
+            return make<UnsignedShort>(user_defined_value.value);
+          default:
+            return unspecified;
+        }
       };
+
+      const auto current_message = slot->load();
+      return current_message and not current_message->value.empty() ? evaluate(*current_message)
+                                                                     : unspecified;
+    };
 #else
     throw SyntaxError(
       "The ability to have ROS 2 topics as values for `UserDefinedValueCondition` is enabled only "
@@ -0,0 +1,192 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <openscenario_interpreter/context_patch.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+using openscenario_interpreter::ContextPatch;
+
+struct Element
+{
+  std::string name;
+
+  int state = 0;
+
+  std::vector<Element> elements;
+};
+
+auto serialize(ContextPatch & context_patch, nlohmann::json & json, const Element & element)
+  -> void
+{
+  json["name"] = element.name;
+
+  context_patch.track(
+    &element, json, [&element](nlohmann::json & json) { json["currentState"] = element.state; });
+
+  json["Element"] = nlohmann::json::array();
+
+  for (const auto & each : element.elements) {
+    nlohmann::json child;
+    const ContextPatch::Descend descend(context_patch, "Element", json["Element"].size());
+    serialize(context_patch, child, each);
+    json["Element"].push_back(child);
+  }
+}
+
+auto snapshot(ContextPatch & context_patch, const Element & element) -> nlohmann::json
+{
+  nlohmann::json json;
+  serialize(context_patch, json, element);
+  return json;
+}
+
+auto freshSnapshot(const Element & element) -> nlohmann::json
+{
+  ContextPatch untracked;
+  return snapshot(untracked, element);
+}
+
+auto makeStoryboard() -> Element
+{
+  return {
+    "storyboard",
+    0,
+    {{"act", 0, {{"event-1", 0, {}}, {"event-2", 0, {}}}}, {"another-act", 0, {}}}};
+}
+}  // namespace
+
+TEST(ContextPatch, patchedSnapshotEqualsFreshSnapshot)
+{
+  ContextPatch context_patch(true);
+  auto storyboard = makeStoryboard();
+  auto published = snapshot(context_patch, storyboard);
+  ASSERT_TRUE(context_patch.tracking());
+
+  for (int frame = 1; frame <= 3; ++frame) {
+    storyboard.state = frame;
+    context_patch.touch(&storyboard);
+    storyboard.elements[0].elements[frame % 2].state = frame;
+    context_patch.touch(&storyboard.elements[0].elements[frame % 2]);
+    if (frame == 2) {
+      storyboard.elements[1].state = frame;
+      context_patch.touch(&storyboard.elements[1]);
+    }
+    published = published.patch(context_patch.makePatch());
+    EXPECT_EQ(published, freshSnapshot(storyboard));
+  }
+}
+
+TEST(ContextPatch, descendBuildsPointerToElement)
+{
+  ContextPatch context_patch(true);
+  auto storyboard = makeStoryboard();
+  snapshot(context_patch, storyboard);
+
+  storyboard.elements[0].elements[1].state = 1;
+  context_patch.touch(&storyboard.elements[0].elements[1]);
+
+  const auto patch = context_patch.makePatch();
+  ASSERT_EQ(patch.size(), 1u);
+  EXPECT_EQ(patch[0]["op"], "replace");
+  EXPECT_EQ(patch[0]["path"], "/Element/0/Element/1/currentState");
+  EXPECT_EQ(patch[0]["value"], 1);
+}
+
+TEST(ContextPatch, patchOnlyTouchedAndChangedValues)
+{
+  ContextPatch context_patch(true);
+  auto storyboard = makeStoryboard();
+  snapshot(context_patch, storyboard);
+
+  storyboard.elements[1].state = 1;
+  EXPECT_TRUE(context_patch.makePatch().empty());
+
+  context_patch.touch(&storyboard.elements[0]);
+  EXPECT_TRUE(context_patch.makePatch().empty());
+
+  /// @note Values changed without a touch are patched as soon as the element is touched.
+  context_patch.touch(&storyboard.elements[1]);
+  EXPECT_EQ(context_patch.makePatch().size(), 1u);
+
+  /// @note Values are compared with the ones published last, not with the snapshot.
+  context_patch.touch(&storyboard.elements[1]);
+  EXPECT_TRUE(context_patch.makePatch().empty());
+}
+
+TEST(ContextPatch, untouchForgetsTouchedElements)
+{
+  ContextPatch context_patch(true);
+  auto storyboard = makeStoryboard();
+  snapshot(context_patch, storyboard);
+
+  storyboard.state = 1;
+  context_patch.touch(&storyboard);
+  context_patch.untouch();
+  EXPECT_TRUE(context_patch.makePatch().empty());
+}
+
+TEST(ContextPatch, disabledContextPatchTracksNothing)
+{
+  ContextPatch context_patch;
+  auto storyboard = makeStoryboard();
+  EXPECT_EQ(snapshot(context_patch, storyboard), freshSnapshot(storyboard));
+  EXPECT_FALSE(context_patch.tracking());
+
+  storyboard.state = 1;
+  context_patch.touch(&storyboard);
+  EXPECT_TRUE(context_patch.makePatch().empty());
+}
+
+TEST(ContextPatch, enableAndClearForgetElements)
+{
+  ContextPatch context_patch;
+  context_patch.enable(true);
+  auto storyboard = makeStoryboard();
+  const auto published = snapshot(context_patch, storyboard);
+  EXPECT_EQ(published, freshSnapshot(storyboard));
+  EXPECT_TRUE(context_patch.tracking());
+
+  storyboard.state = 1;
+  context_patch.touch(&storyboard);
+  context_patch.clear();
+  EXPECT_FALSE(context_patch.tracking());
+  EXPECT_TRUE(context_patch.makePatch().empty());
+}
+
+TEST(ContextPatch, descendIntoUntrackedElement)
+{
+  ContextPatch context_patch(true);
+  auto storyboard = makeStoryboard();
+  snapshot(context_patch, storyboard);
+  {
+    /// @note Elements without a ContextPatch (e.g. default constructed Trigger) descend nothing.
+    const ContextPatch::Descend descend(nullptr, "StartTrigger");
+    const ContextPatch::Descend tracked(context_patch, "Element", 1);
+    nlohmann::json json;
+    serialize(context_patch, json, storyboard.elements[1]);
+  }
+
+  storyboard.elements[1].state = 1;
+  context_patch.touch(&storyboard.elements[1]);
+
+  const auto patch = context_patch.makePatch();
+  ASSERT_EQ(patch.size(), 1u);
+  EXPECT_EQ(patch[0]["path"], "/Element/1/currentState");
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <openscenario_interpreter/context_patch.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/parameter_value_distribution.hpp>
 #include <openscenario_preprocessor/openscenario_preprocessor.hpp>
@@ -76,11 +77,14 @@ bool Preprocessor::validateXOSC(const boost::filesystem::path & file_name, bool
 
 void Preprocessor::preprocessScenario(ScenarioSet & scenario)
 {
+  using openscenario_interpreter::ContextPatch;
   using openscenario_interpreter::OpenScenario;
   using openscenario_interpreter::ParameterValueDistribution;
 
   if (validateXOSC(scenario.path)) {
-    if (auto script = std::make_shared<OpenScenario>(scenario.path);
+    // NOTE: The script is never published, so its context is not tracked.
+    ContextPatch context_patch;
+    if (auto script = std::make_shared<OpenScenario>(scenario.path, context_patch);
         script->category.is<ParameterValueDistribution>()) {
       std::cout << "ParameterValueDistribution!!" << std::endl;
       auto base_scenario_path =
@@ -20,6 +20,7 @@
 #endif
 
 #include <mutex>
+#include <nlohmann/json.hpp>
 #include <openscenario_interpreter_msgs/msg/context.hpp>
 #include <openscenario_visualization/context_panel_plugin.hpp>
 #include <rviz_common/panel.hpp>
@@ -66,6 +67,8 @@ private:
   void contextCallback(const openscenario_interpreter_msgs::msg::Context::ConstSharedPtr msg);
   void spin();
   std::string context_;
+  /// @note Context restored from full snapshots and JSON Patch deltas published by the interpreter.
+  nlohmann::json context_json_;
   double simulation_time_;
   std::vector<std::string> item_vec_;
   std::vector<std::vector<std::string>> condition_group_vec_;
@@ -97,12 +97,14 @@ protected:
   rviz_common::properties::FloatProperty * property_value_scale_;
 
 private:
+  void updateContext(const Context::ConstSharedPtr msg_ptr);
   void loadConditionGroups(const Context::ConstSharedPtr msg_ptr);
   void processStory(const YAML::Node & story);
   void processManeuver(const YAML::Node & maneuver);
   void processEvent(const YAML::Node & event);
   rclcpp::Subscription<Context>::SharedPtr simulation_context_sub_;
   Context::ConstSharedPtr last_msg_ptr_;
+  nlohmann::json context_;
   std::shared_ptr<ConditionGroupsCollection> condition_groups_collection_ptr_;
 };
 
@@ -56,7 +56,19 @@ void ContextPanel::contextCallback(
 {
   context_ = msg->data;
   simulation_time_ = msg->time;
-  json j_ = json::parse(context_);
+  if (const auto data = json::parse(context_); not data.is_array()) {
+    context_json_ = data;
+  } else if (context_json_.is_null()) {
+    return;  // The interpreter is in delta mode. Wait for the next full snapshot.
+  } else {
+    try {
+      context_json_ = context_json_.patch(data);
+    } catch (const json::exception &) {
+      context_json_ = nullptr;
+      return;
+    }
+  }
+  json & j_ = context_json_;
   condition_group_vec_.clear();
   item_vec_.clear();
   auto story_json = j_["OpenSCENARIO"]["Storyboard"]["Story"];
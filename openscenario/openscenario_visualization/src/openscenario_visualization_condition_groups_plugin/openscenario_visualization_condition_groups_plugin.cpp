@@ -23,6 +23,7 @@
 #include <rviz_common/display_context.hpp>
 #include <rviz_common/uniform_string_stream.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace openscenario_visualization
@@ -159,6 +160,10 @@ void VisualizationConditionGroupsDisplay::unsubscribe() { simulation_context_sub
 
 void VisualizationConditionGroupsDisplay::processMessage(const Context::ConstSharedPtr msg_ptr)
 {
+  if (msg_ptr != last_msg_ptr_) {
+    updateContext(msg_ptr);
+  }
+
   if (!overlay_->isVisible()) return;
 
   // Create a QImage and fill it with transparent color.
@@ -217,19 +222,44 @@ void VisualizationConditionGroupsDisplay::updateVisualization()
   }
 }
 
+void VisualizationConditionGroupsDisplay::updateContext(const Context::ConstSharedPtr msg_ptr)
+{
+  if (!msg_ptr) return;
+
+  nlohmann::json data;
+  try {
+    data = nlohmann::json::parse(msg_ptr->data);
+  } catch (const std::exception & e) {
+    throw std::runtime_error(std::string("Failed to parse context: ") + e.what());
+  }
+
+  // A JSON array is a JSON Patch to the previous message, published in the delta mode.
+  if (not data.is_array()) {
+    context_ = std::move(data);
+  } else if (not context_.is_null()) {
+    try {
+      context_ = context_.patch(data);
+    } catch (const nlohmann::json::exception &) {
+      context_ = nullptr;  // Wait for the next full snapshot.
+    }
+  }
+}
+
 void VisualizationConditionGroupsDisplay::loadConditionGroups(const Context::ConstSharedPtr msg_ptr)
 {
   if (!msg_ptr) return;
 
+  condition_groups_collection_ptr_->clear();
+
+  if (context_.is_null()) return;
+
   YAML::Node data;
   try {
-    data = YAML::Load(msg_ptr->data);
+    data = YAML::Load(context_.dump());
   } catch (const std::exception & e) {
     throw std::runtime_error(std::string("Failed to load YAML: ") + e.what());
   }
 
-  condition_groups_collection_ptr_->clear();
-
   auto stories = data["OpenSCENARIO"]["Storyboard"]["Story"];
   for (const auto & story : stories) {
     processStory(story);
@@ -18,6 +18,7 @@
 #include <behaviortree_cpp_v3/action_node.h>
 
 #include <algorithm>
+#include <behavior_tree_plugin/action_node_context.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <memory>
 #include <optional>
@@ -63,10 +64,14 @@ public:
   auto getYieldStopDistance(const lanelet::Ids & following_lanelets) const -> std::optional<double>;
   auto getOtherEntityStatus(lanelet::Id lanelet_id) const
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
+  auto getOtherEntityStatus(const lanelet::Ids & lanelet_ids) const
+    -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
   auto stopEntity() const -> void;
   auto getHorizon() const -> double;
   auto getActionStatus() const noexcept -> traffic_simulator_msgs::msg::ActionStatus;
   auto getEntityName() const noexcept -> std::string;
+  /// @note Resolved once per query, so that other entities are skipped by id instead of by name.
+  auto getEntityId() const -> std::optional<traffic_simulator::EntityId>;
 
   /// throws if the derived class return RUNNING.
   auto executeTick() -> BT::NodeStatus override;
@@ -77,24 +82,17 @@ public:
   {
     return {
       // clang-format off
-      BT::InputPort<double>("current_time"),
-      BT::InputPort<double>("step_time"),
-      BT::InputPort<EntityStatusDict>("other_entity_status"),
-      BT::InputPort<std::optional<double>>("target_speed"),
-      BT::InputPort<std::shared_ptr<hdmap_utils::HdMapUtils>>("hdmap_utils"),
-      BT::InputPort<std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>>("entity_status"),
-      BT::InputPort<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>("entity_type_list"),
-      BT::InputPort<lanelet::Ids>("route_lanelets"),
-      BT::InputPort<traffic_simulator::behavior::Request>("request"),
-      BT::InputPort<std::shared_ptr<traffic_simulator::TrafficLightManager>>("traffic_light_manager"),
       BT::OutputPort<std::optional<traffic_simulator_msgs::msg::Obstacle>>("obstacle"),
       BT::OutputPort<std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>>("updated_status"),
       BT::OutputPort<traffic_simulator_msgs::msg::WaypointsArray>("waypoints"),
-      BT::OutputPort<traffic_simulator::behavior::Request>("request"),
       // clang-format on
     };
   }
-  auto getBlackBoardValues() -> void;
+  /**
+   * @brief Throw if a required input has not been set by the behavior plugin, and copy the inputs
+   * that the action nodes modify while ticking.
+   */
+  auto validateInputs() -> void;
   auto getEntityStatus(const std::string & target_name) const
     -> traffic_simulator::CanonicalizedEntityStatus;
   auto getDistanceToTargetEntityPolygon(
@@ -110,17 +108,18 @@ public:
     -> traffic_simulator::CanonicalizedEntityStatus;
 
 protected:
-  traffic_simulator::behavior::Request request;
-  std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils;
-  std::shared_ptr<traffic_simulator::TrafficLightManager> traffic_light_manager;
-  std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus> entity_status;
-  double current_time;
-  double step_time;
+  const std::shared_ptr<const ActionNodeContext> context;
+  const traffic_simulator::behavior::Request & request;
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils;
+  const std::shared_ptr<traffic_simulator::TrafficLightManager> & traffic_light_manager;
+  const std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus> & entity_status;
+  const double & current_time;
+  const double & step_time;
   std::optional<double> target_speed;
   std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus> updated_status;
-  EntityStatusDict other_entity_status;
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list;
-  lanelet::Ids route_lanelets;
+  const EntityStatusSnapshotPtr & other_entity_status;
+  const EntityTypeDict & entity_type_list;
+  const lanelet::Ids & route_lanelets;
 
 private:
   auto getDistanceToTargetEntityOnCrosswalk(
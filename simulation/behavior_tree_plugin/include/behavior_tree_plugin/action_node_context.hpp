@@ -0,0 +1,75 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_TREE_PLUGIN__ACTION_NODE_CONTEXT_HPP_
+#define BEHAVIOR_TREE_PLUGIN__ACTION_NODE_CONTEXT_HPP_
+
+#include <geometry/spline/catmull_rom_spline.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <traffic_simulator/data_type/behavior.hpp>
+#include <traffic_simulator/data_type/entity_status.hpp>
+#include <traffic_simulator/data_type/lane_change.hpp>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
+#include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+#include <traffic_simulator_msgs/msg/pedestrian_parameters.hpp>
+#include <traffic_simulator_msgs/msg/polyline_trajectory.hpp>
+#include <traffic_simulator_msgs/msg/vehicle_parameters.hpp>
+
+namespace entity_behavior
+{
+/**
+ * @brief Inputs of the action nodes, filled by the behavior plugin through the setters of
+ * BehaviorPluginBase.
+ * @note The plugin owns one context and shares it with every action node of its tree when the tree
+ * is instantiated, so the action nodes read the inputs by reference instead of looking them up in
+ * the blackboard on every tick. Only the outputs of the action nodes go through the blackboard.
+ */
+struct ActionNodeContext
+{
+  static auto key() -> const std::string &
+  {
+    static const std::string key = "action_node_context";
+    return key;
+  }
+
+  double current_time = 0.0;
+  double step_time = 0.0;
+  traffic_simulator::behavior::Request request = traffic_simulator::behavior::Request::NONE;
+  std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils;
+  std::shared_ptr<traffic_simulator::TrafficLightManager> traffic_light_manager;
+  std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus> entity_status;
+  std::optional<double> target_speed;
+  EntityStatusSnapshotPtr other_entity_status;
+  EntityTypeDict entity_type_list;
+  lanelet::Ids route_lanelets;
+  traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
+  traffic_simulator_msgs::msg::VehicleParameters vehicle_parameters;
+  traffic_simulator_msgs::msg::PedestrianParameters pedestrian_parameters;
+  std::shared_ptr<math::geometry::CatmullRomSpline> reference_trajectory;
+  std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> polyline_trajectory;
+  std::optional<traffic_simulator::lane_change::Parameter> lane_change_parameters;
+
+  /// @note Inputs without a usable default value. The action nodes that need them refuse to tick
+  /// until the plugin has set them.
+  bool pedestrian_parameters_is_set = false;
+  bool reference_trajectory_is_set = false;
+  bool vehicle_parameters_is_set = false;
+};
+}  // namespace entity_behavior
+
+#endif  // BEHAVIOR_TREE_PLUGIN__ACTION_NODE_CONTEXT_HPP_
@@ -18,6 +18,7 @@
 #include <behaviortree_cpp_v3/bt_factory.h>
 #include <behaviortree_cpp_v3/loggers/bt_cout_logger.h>
 
+#include <behavior_tree_plugin/action_node_context.hpp>
 #include <behavior_tree_plugin/pedestrian/follow_lane_action.hpp>
 #include <behavior_tree_plugin/pedestrian/walk_straight_action.hpp>
 #include <behavior_tree_plugin/transition_events/transition_events.hpp>
@@ -41,6 +42,11 @@ public:
   void configure(const rclcpp::Logger & logger) override;
   void update(double current_time, double step_time) override;
   const std::string & getCurrentAction() const override;
+
+  auto getLaneChangeParameters() -> traffic_simulator::lane_change::Parameter override;
+
+  auto setLaneChangeParameters(const traffic_simulator::lane_change::Parameter &)
+    -> void override;
 #define DEFINE_GETTER_SETTER(NAME, TYPE)                                                    \
   TYPE get##NAME() override { return tree_.rootBlackboard()->get<TYPE>(get##NAME##Key()); } \
   void set##NAME(const TYPE & value) override                                               \
@@ -48,36 +54,51 @@ public:
     tree_.rootBlackboard()->set<TYPE>(get##NAME##Key(), value);                             \
   }
 
+#define DEFINE_CONTEXT_GETTER_SETTER(NAME, FIELD, TYPE)   \
+  TYPE get##NAME() override { return context_->FIELD; } \
+  void set##NAME(const TYPE & value) override { context_->FIELD = value; }
+
+#define DEFINE_REQUIRED_CONTEXT_GETTER_SETTER(NAME, FIELD, TYPE) \
+  TYPE get##NAME() override { return context_->FIELD; }        \
+  void set##NAME(const TYPE & value) override                  \
+  {                                                            \
+    context_->FIELD = value;                                   \
+    context_->FIELD##_is_set = true;                           \
+  }
+
   // clang-format off
-  DEFINE_GETTER_SETTER(BehaviorParameter,    traffic_simulator_msgs::msg::BehaviorParameter)
-  DEFINE_GETTER_SETTER(CurrentTime,          double)
   DEFINE_GETTER_SETTER(DebugMarker,          std::vector<visualization_msgs::msg::Marker>)
-  DEFINE_GETTER_SETTER(EntityTypeList,       EntityTypeDict)
   DEFINE_GETTER_SETTER(GoalPoses,            std::vector<geometry_msgs::msg::Pose>)
-  DEFINE_GETTER_SETTER(EntityStatus,         std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
-  DEFINE_GETTER_SETTER(PolylineTrajectory,   std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>)
-  DEFINE_GETTER_SETTER(HdMapUtils,           std::shared_ptr<hdmap_utils::HdMapUtils>)
-  DEFINE_GETTER_SETTER(LaneChangeParameters, traffic_simulator::lane_change::Parameter)
   DEFINE_GETTER_SETTER(Obstacle,             std::optional<traffic_simulator_msgs::msg::Obstacle>)
-  DEFINE_GETTER_SETTER(OtherEntityStatus,    EntityStatusDict)
-  DEFINE_GETTER_SETTER(PedestrianParameters, traffic_simulator_msgs::msg::PedestrianParameters)
-  DEFINE_GETTER_SETTER(ReferenceTrajectory,  std::shared_ptr<math::geometry::CatmullRomSpline>)
-  DEFINE_GETTER_SETTER(Request,              traffic_simulator::behavior::Request)
-  DEFINE_GETTER_SETTER(RouteLanelets,        lanelet::Ids)
-  DEFINE_GETTER_SETTER(StepTime,             double)
-  DEFINE_GETTER_SETTER(TargetSpeed,          std::optional<double>)
-  DEFINE_GETTER_SETTER(TrafficLightManager,  std::shared_ptr<traffic_simulator::TrafficLightManager>)
   DEFINE_GETTER_SETTER(UpdatedStatus,        std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
-  DEFINE_GETTER_SETTER(VehicleParameters,    traffic_simulator_msgs::msg::VehicleParameters)
   DEFINE_GETTER_SETTER(Waypoints,            traffic_simulator_msgs::msg::WaypointsArray)
+
+  DEFINE_CONTEXT_GETTER_SETTER(BehaviorParameter,    behavior_parameter,    traffic_simulator_msgs::msg::BehaviorParameter)
+  DEFINE_CONTEXT_GETTER_SETTER(CurrentTime,          current_time,          double)
+  DEFINE_CONTEXT_GETTER_SETTER(EntityTypeList,       entity_type_list,      EntityTypeDict)
+  DEFINE_CONTEXT_GETTER_SETTER(EntityStatus,         entity_status,         std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
+  DEFINE_CONTEXT_GETTER_SETTER(PolylineTrajectory,   polyline_trajectory,   std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>)
+  DEFINE_CONTEXT_GETTER_SETTER(HdMapUtils,           hdmap_utils,           std::shared_ptr<hdmap_utils::HdMapUtils>)
+  DEFINE_CONTEXT_GETTER_SETTER(OtherEntityStatus,    other_entity_status,   EntityStatusSnapshotPtr)
+  DEFINE_REQUIRED_CONTEXT_GETTER_SETTER(PedestrianParameters, pedestrian_parameters, traffic_simulator_msgs::msg::PedestrianParameters)
+  DEFINE_REQUIRED_CONTEXT_GETTER_SETTER(ReferenceTrajectory,  reference_trajectory,  std::shared_ptr<math::geometry::CatmullRomSpline>)
+  DEFINE_CONTEXT_GETTER_SETTER(Request,              request,               traffic_simulator::behavior::Request)
+  DEFINE_CONTEXT_GETTER_SETTER(RouteLanelets,        route_lanelets,        lanelet::Ids)
+  DEFINE_CONTEXT_GETTER_SETTER(StepTime,             step_time,             double)
+  DEFINE_CONTEXT_GETTER_SETTER(TargetSpeed,          target_speed,          std::optional<double>)
+  DEFINE_CONTEXT_GETTER_SETTER(TrafficLightManager,  traffic_light_manager, std::shared_ptr<traffic_simulator::TrafficLightManager>)
+  DEFINE_REQUIRED_CONTEXT_GETTER_SETTER(VehicleParameters,    vehicle_parameters,    traffic_simulator_msgs::msg::VehicleParameters)
   // clang-format on
 
+#undef DEFINE_CONTEXT_GETTER_SETTER
+#undef DEFINE_REQUIRED_CONTEXT_GETTER_SETTER
 #undef DEFINE_GETTER_SETTER
 
 private:
   BT::NodeStatus tickOnce(double current_time, double step_time);
-  auto createBehaviorTree(const std::string & format_path) -> BT::Tree;
-  BT::BehaviorTreeFactory factory_;
+  static auto getFactory() -> BT::BehaviorTreeFactory &;
+  static auto getTreeText() -> const std::string &;
+  const std::shared_ptr<ActionNodeContext> context_ = std::make_shared<ActionNodeContext>();
   BT::Tree tree_;
   std::unique_ptr<behavior_tree_plugin::LoggingEvent> logging_event_ptr_;
   std::unique_ptr<behavior_tree_plugin::ResetRequestEvent> reset_request_event_ptr_;
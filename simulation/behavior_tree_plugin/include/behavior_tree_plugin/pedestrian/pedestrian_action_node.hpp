@@ -28,29 +28,19 @@ class PedestrianActionNode : public ActionNode
 {
 public:
   PedestrianActionNode(const std::string & name, const BT::NodeConfiguration & config);
-  void getBlackBoardValues();
+  void validateInputs();
   static BT::PortsList providedPorts()
   {
-    BT::PortsList ports = {
-      // clang-format off
-      BT::InputPort<traffic_simulator_msgs::msg::BehaviorParameter>("behavior_parameter"),
-      BT::InputPort<traffic_simulator_msgs::msg::PedestrianParameters>("pedestrian_parameters"),
-      // clang-format on
-    };
-    BT::PortsList parent_ports = entity_behavior::ActionNode::providedPorts();
-    for (const auto & parent_port : parent_ports) {
-      ports.emplace(parent_port.first, parent_port.second);
-    }
-    return ports;
+    return entity_behavior::ActionNode::providedPorts();
   }
-  traffic_simulator_msgs::msg::PedestrianParameters pedestrian_parameters;
+  const traffic_simulator_msgs::msg::PedestrianParameters & pedestrian_parameters;
   auto calculateUpdatedEntityStatusInWorldFrame(double target_speed) const
     -> traffic_simulator::CanonicalizedEntityStatus;
   auto calculateUpdatedEntityStatus(double target_speed) const
     -> traffic_simulator::CanonicalizedEntityStatus;
 
 protected:
-  traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
+  const traffic_simulator_msgs::msg::BehaviorParameter & behavior_parameter;
 
 private:
   auto estimateLaneletPose(const geometry_msgs::msg::Pose & pose) const
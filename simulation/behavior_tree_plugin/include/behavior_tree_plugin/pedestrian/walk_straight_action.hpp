@@ -45,7 +45,7 @@ class WalkStraightAction : public entity_behavior::PedestrianActionNode
 public:
   WalkStraightAction(const std::string & name, const BT::NodeConfiguration & config);
   BT::NodeStatus tick() override;
-  void getBlackBoardValues();
+  void validateInputs();
   static BT::PortsList providedPorts()
   {
     BT::PortsList ports = {};
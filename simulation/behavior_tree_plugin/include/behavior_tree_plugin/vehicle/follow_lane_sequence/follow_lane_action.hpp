@@ -32,7 +32,7 @@ class FollowLaneAction : public entity_behavior::VehicleActionNode
 public:
   FollowLaneAction(const std::string & name, const BT::NodeConfiguration & config);
   BT::NodeStatus tick() override;
-  void getBlackBoardValues();
+  void validateInputs();
   static BT::PortsList providedPorts()
   {
     BT::PortsList ports = {};
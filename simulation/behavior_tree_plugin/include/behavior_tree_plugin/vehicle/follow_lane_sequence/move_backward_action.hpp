@@ -32,7 +32,7 @@ class MoveBackwardAction : public entity_behavior::VehicleActionNode
 public:
   MoveBackwardAction(const std::string & name, const BT::NodeConfiguration & config);
   BT::NodeStatus tick() override;
-  void getBlackBoardValues();
+  void validateInputs();
   static BT::PortsList providedPorts()
   {
     BT::PortsList ports = {};
@@ -23,9 +23,8 @@ namespace vehicle
 {
 struct FollowPolylineTrajectoryAction : public VehicleActionNode
 {
-  std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> polyline_trajectory;
-
-  std::optional<double> target_speed;
+  const std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> & polyline_trajectory =
+    context->polyline_trajectory;
 
   using VehicleActionNode::VehicleActionNode;
 
@@ -34,8 +33,6 @@ struct FollowPolylineTrajectoryAction : public VehicleActionNode
   auto calculateObstacle(const traffic_simulator_msgs::msg::WaypointsArray &)
     -> const std::optional<traffic_simulator_msgs::msg::Obstacle> override;
 
-  static auto providedPorts() -> BT::PortsList;
-
   auto tick() -> BT::NodeStatus override;
 };
 }  // namespace vehicle
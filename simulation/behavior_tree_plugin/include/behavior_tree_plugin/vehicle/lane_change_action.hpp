@@ -37,18 +37,12 @@ public:
   BT::NodeStatus tick() override;
   static BT::PortsList providedPorts()
   {
-    BT::PortsList ports = {
-      BT::InputPort<traffic_simulator::lane_change::Parameter>("lane_change_parameters")};
-    BT::PortsList parent_ports = entity_behavior::VehicleActionNode::providedPorts();
-    for (const auto & parent_port : parent_ports) {
-      ports.emplace(parent_port.first, parent_port.second);
-    }
-    return ports;
+    return entity_behavior::VehicleActionNode::providedPorts();
   }
   const traffic_simulator_msgs::msg::WaypointsArray calculateWaypoints() override;
   const std::optional<traffic_simulator_msgs::msg::Obstacle> calculateObstacle(
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints) override;
-  void getBlackBoardValues();
+  void validateInputs();
 
 private:
   std::optional<math::geometry::HermiteCurve> curve_;
@@ -37,21 +37,10 @@ class VehicleActionNode : public ActionNode
 public:
   VehicleActionNode(const std::string & name, const BT::NodeConfiguration & config);
   ~VehicleActionNode() override = default;
-  void getBlackBoardValues();
+  void validateInputs();
   static BT::PortsList providedPorts()
   {
-    BT::PortsList ports = {
-      // clang-format off
-      BT::InputPort<std::shared_ptr<math::geometry::CatmullRomSpline>>("reference_trajectory"),
-      BT::InputPort<traffic_simulator_msgs::msg::BehaviorParameter>("behavior_parameter"),
-      BT::InputPort<traffic_simulator_msgs::msg::VehicleParameters>("vehicle_parameters"),
-      // clang-format on
-    };
-    BT::PortsList parent_ports = entity_behavior::ActionNode::providedPorts();
-    for (const auto & parent_port : parent_ports) {
-      ports.emplace(parent_port.first, parent_port.second);
-    }
-    return ports;
+    return entity_behavior::ActionNode::providedPorts();
   }
   auto calculateUpdatedEntityStatus(double target_speed) const
     -> traffic_simulator::CanonicalizedEntityStatus;
@@ -62,9 +51,9 @@ public:
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints) = 0;
 
 protected:
-  traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
-  traffic_simulator_msgs::msg::VehicleParameters vehicle_parameters;
-  std::shared_ptr<math::geometry::CatmullRomSpline> reference_trajectory;
+  const traffic_simulator_msgs::msg::BehaviorParameter & behavior_parameter;
+  const traffic_simulator_msgs::msg::VehicleParameters & vehicle_parameters;
+  const std::shared_ptr<math::geometry::CatmullRomSpline> & reference_trajectory;
   std::unique_ptr<math::geometry::CatmullRomSubspline> trajectory;
 };
 }  // namespace entity_behavior
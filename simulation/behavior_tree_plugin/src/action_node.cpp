@@ -16,7 +16,9 @@
 
 #include <algorithm>
 #include <behavior_tree_plugin/action_node.hpp>
+#include <cmath>
 #include <geometry/bounding_box.hpp>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <rclcpp/rclcpp.hpp>
@@ -32,49 +34,46 @@
 namespace entity_behavior
 {
 ActionNode::ActionNode(const std::string & name, const BT::NodeConfiguration & config)
-: BT::ActionNodeBase(name, config)
+: BT::ActionNodeBase(name, config),
+  context([&]() {
+    if (std::shared_ptr<const ActionNodeContext> action_node_context;
+        config.blackboard and
+        config.blackboard->get(ActionNodeContext::key(), action_node_context) and
+        action_node_context) {
+      return action_node_context;
+    }
+    THROW_SIMULATION_ERROR("failed to get the action node context in ActionNode ", name, ".");
+  }()),
+  request(context->request),
+  hdmap_utils(context->hdmap_utils),
+  traffic_light_manager(context->traffic_light_manager),
+  entity_status(context->entity_status),
+  current_time(context->current_time),
+  step_time(context->step_time),
+  other_entity_status(context->other_entity_status),
+  entity_type_list(context->entity_type_list),
+  route_lanelets(context->route_lanelets)
 {
 }
 
 auto ActionNode::executeTick() -> BT::NodeStatus { return BT::ActionNodeBase::executeTick(); }
 
-auto ActionNode::getBlackBoardValues() -> void
+auto ActionNode::validateInputs() -> void
 {
-  if (!getInput<traffic_simulator::behavior::Request>("request", request)) {
-    THROW_SIMULATION_ERROR("failed to get input request in ActionNode");
-  }
-  if (!getInput<double>("step_time", step_time)) {
-    THROW_SIMULATION_ERROR("failed to get input step_time in ActionNode");
-  }
-  if (!getInput<double>("current_time", current_time)) {
-    THROW_SIMULATION_ERROR("failed to get input current_time in ActionNode");
-  }
-  if (!getInput<std::shared_ptr<hdmap_utils::HdMapUtils>>("hdmap_utils", hdmap_utils)) {
+  if (not hdmap_utils) {
     THROW_SIMULATION_ERROR("failed to get input hdmap_utils in ActionNode");
   }
-  if (!getInput<std::shared_ptr<traffic_simulator::TrafficLightManager>>(
-        "traffic_light_manager", traffic_light_manager)) {
+  if (not traffic_light_manager) {
     THROW_SIMULATION_ERROR("failed to get input traffic_light_manager in ActionNode");
   }
-  if (!getInput<std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>>(
-        "entity_status", entity_status)) {
+  if (not entity_status) {
     THROW_SIMULATION_ERROR("failed to get input entity_status in ActionNode");
   }
-
-  if (!getInput<std::optional<double>>("target_speed", target_speed)) {
-    target_speed = std::nullopt;
-  }
-
-  if (!getInput<EntityStatusDict>("other_entity_status", other_entity_status)) {
+  if (not other_entity_status) {
     THROW_SIMULATION_ERROR("failed to get input other_entity_status in ActionNode");
   }
-  if (!getInput<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>(
-        "entity_type_list", entity_type_list)) {
-    THROW_SIMULATION_ERROR("failed to get input entity_type_list in ActionNode");
-  }
-  if (!getInput<lanelet::Ids>("route_lanelets", route_lanelets)) {
-    THROW_SIMULATION_ERROR("failed to get input route_lanelets in ActionNode");
-  }
+  /// @note target_speed is copied because the action nodes overwrite it while ticking.
+  target_speed = context->target_speed;
 }
 
 auto ActionNode::getHorizon() const -> double
@@ -93,11 +92,25 @@ auto ActionNode::getOtherEntityStatus(lanelet::Id lanelet_id) const
   -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
 {
   std::vector<traffic_simulator::CanonicalizedEntityStatus> ret;
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() &&
-      traffic_simulator::isSameLaneletId(status.second, lanelet_id)) {
-      ret.emplace_back(status.second);
+  const auto entity_id = getEntityId();
+  for (const auto & entry : other_entity_status->getEntitiesOnLanelet(lanelet_id)) {
+    if (entry->first != entity_id) {
+      ret.emplace_back(entry->second);
+    }
+  }
+  return ret;
+}
+
+auto ActionNode::getOtherEntityStatus(const lanelet::Ids & lanelet_ids) const
+  -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
+{
+  std::vector<traffic_simulator::CanonicalizedEntityStatus> ret;
+  const auto entity_id = getEntityId();
+  for (const auto & lanelet_id : std::set<lanelet::Id>(lanelet_ids.begin(), lanelet_ids.end())) {
+    for (const auto & entry : other_entity_status->getEntitiesOnLanelet(lanelet_id)) {
+      if (entry->first != entity_id) {
+        ret.emplace_back(entry->second);
+      }
     }
   }
   return ret;
@@ -143,15 +156,17 @@ auto ActionNode::getRightOfWayEntities(const lanelet::Ids & following_lanelets)
     };
 
   std::vector<traffic_simulator::CanonicalizedEntityStatus> ret;
+  const auto entity_id = getEntityId();
   const auto lanelet_ids_list = hdmap_utils->getRightOfWayLaneletIds(following_lanelets);
-  for (const auto & status : other_entity_status) {
-    for (const auto & following_lanelet : following_lanelets) {
-      for (const lanelet::Id & lanelet_id : lanelet_ids_list.at(following_lanelet)) {
-        if (
-          status.second.laneMatchingSucceed() &&
-          traffic_simulator::isSameLaneletId(status.second, lanelet_id) &&
-          not is_the_same_right_of_way(lanelet_id, following_lanelet)) {
-          ret.emplace_back(status.second);
+  for (const auto & following_lanelet : following_lanelets) {
+    for (const lanelet::Id & lanelet_id : lanelet_ids_list.at(following_lanelet)) {
+      const auto & entries = other_entity_status->getEntitiesOnLanelet(lanelet_id);
+      if (entries.empty() or is_the_same_right_of_way(lanelet_id, following_lanelet)) {
+        continue;
+      }
+      for (const auto & entry : entries) {
+        if (entry->first != entity_id) {
+          ret.emplace_back(entry->second);
         }
       }
     }
@@ -171,12 +186,11 @@ auto ActionNode::getRightOfWayEntities() const
   if (lanelet_ids.empty()) {
     return ret;
   }
-  for (const auto & status : other_entity_status) {
-    for (const lanelet::Id & lanelet_id : lanelet_ids) {
-      if (
-        status.second.laneMatchingSucceed() &&
-        traffic_simulator::isSameLaneletId(status.second, lanelet_id)) {
-        ret.emplace_back(status.second);
+  const auto entity_id = getEntityId();
+  for (const lanelet::Id & lanelet_id : lanelet_ids) {
+    for (const auto & entry : other_entity_status->getEntitiesOnLanelet(lanelet_id)) {
+      if (entry->first != entity_id) {
+        ret.emplace_back(entry->second);
       }
     }
   }
@@ -231,21 +245,35 @@ auto ActionNode::getDistanceToFrontEntity(
 auto ActionNode::getFrontEntityName(const math::geometry::CatmullRomSplineInterface & spline) const
   -> std::optional<std::string>
 {
+  /**
+   * @note hard-coded parameter, entities farther than this along the spline are not candidates of front entity.
+   */
+  constexpr double front_entity_distance_threshold = 40.0;
+  /// @note the spline starts from the projection of this entity onto its lane.
+  /// So, the search radius around this entity is widened by the lateral offset.
+  const double search_distance =
+    entity_status->laneMatchingSucceed()
+      ? front_entity_distance_threshold + std::abs(entity_status->getLaneletPose().offset)
+      : std::numeric_limits<double>::infinity();
+  const auto entity_id = getEntityId();
   std::vector<double> distances;
   std::vector<std::string> entities;
-  for (const auto & each : other_entity_status) {
-    const auto distance = getDistanceToTargetEntityPolygon(spline, each.first);
+  for (const auto & each : other_entity_status->getEntitiesNear(
+         entity_status->getMapPose().position, search_distance)) {
+    if (each->first == entity_id) {
+      continue;
+    }
+    const auto distance = getDistanceToTargetEntityPolygon(spline, each->second);
     const auto quat = quaternion_operation::getRotation(
-      entity_status->getMapPose().orientation,
-      other_entity_status.at(each.first).getMapPose().orientation);
+      entity_status->getMapPose().orientation, each->second.getMapPose().orientation);
     /**
      * @note hard-coded parameter, if the Yaw value of RPY is in ~1.5708 -> 1.5708, entity is a candidate of front entity.
      */
     if (
       std::fabs(quaternion_operation::convertQuaternionToEulerAngle(quat).z) <=
       boost::math::constants::half_pi<double>()) {
-      if (distance && distance.value() < 40) {
-        entities.emplace_back(each.first);
+      if (distance && distance.value() < front_entity_distance_threshold) {
+        entities.emplace_back(each->second.getName());
         distances.emplace_back(distance.value());
       }
     }
@@ -275,8 +303,8 @@ auto ActionNode::getDistanceToTargetEntityOnCrosswalk(
 auto ActionNode::getEntityStatus(const std::string & target_name) const
   -> traffic_simulator::CanonicalizedEntityStatus
 {
-  if (other_entity_status.find(target_name) != other_entity_status.end()) {
-    return traffic_simulator::CanonicalizedEntityStatus(other_entity_status.at(target_name));
+  if (target_name != getEntityName() and other_entity_status->contains(target_name)) {
+    return traffic_simulator::CanonicalizedEntityStatus(other_entity_status->at(target_name));
   }
   THROW_SIMULATION_ERROR("other entity : ", target_name, " does not exist.");
 }
@@ -339,56 +367,20 @@ auto ActionNode::getDistanceToConflictingEntity(
 auto ActionNode::getConflictingEntityStatusOnCrossWalk(const lanelet::Ids & route_lanelets) const
   -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
 {
-  std::vector<traffic_simulator::CanonicalizedEntityStatus> conflicting_entity_status;
-  auto conflicting_crosswalks = hdmap_utils->getConflictingCrosswalkIds(route_lanelets);
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() &&
-      std::count(
-        conflicting_crosswalks.begin(), conflicting_crosswalks.end(),
-        status.second.getLaneletPose().lanelet_id) >= 1) {
-      conflicting_entity_status.emplace_back(status.second);
-    }
-  }
-  return conflicting_entity_status;
+  return getOtherEntityStatus(hdmap_utils->getConflictingCrosswalkIds(route_lanelets));
 }
 
 auto ActionNode::getConflictingEntityStatusOnLane(const lanelet::Ids & route_lanelets) const
   -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
 {
-  std::vector<traffic_simulator::CanonicalizedEntityStatus> conflicting_entity_status;
-  auto conflicting_lanes = hdmap_utils->getConflictingLaneIds(route_lanelets);
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() && std::count(
-                                               conflicting_lanes.begin(), conflicting_lanes.end(),
-                                               status.second.getLaneletPose().lanelet_id) >= 1) {
-      conflicting_entity_status.emplace_back(status.second);
-    }
-  }
-  return conflicting_entity_status;
+  return getOtherEntityStatus(hdmap_utils->getConflictingLaneIds(route_lanelets));
 }
 
 auto ActionNode::foundConflictingEntity(const lanelet::Ids & following_lanelets) const -> bool
 {
-  auto conflicting_crosswalks = hdmap_utils->getConflictingCrosswalkIds(following_lanelets);
-  auto conflicting_lanes = hdmap_utils->getConflictingLaneIds(following_lanelets);
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() &&
-      std::count(
-        conflicting_crosswalks.begin(), conflicting_crosswalks.end(),
-        status.second.getLaneletPose().lanelet_id) >= 1) {
-      return true;
-    }
-    if (
-      status.second.laneMatchingSucceed() && std::count(
-                                               conflicting_lanes.begin(), conflicting_lanes.end(),
-                                               status.second.getLaneletPose().lanelet_id) >= 1) {
-      return true;
-    }
-  }
-  return false;
+  return not getOtherEntityStatus(hdmap_utils->getConflictingCrosswalkIds(following_lanelets))
+                .empty() or
+         not getOtherEntityStatus(hdmap_utils->getConflictingLaneIds(following_lanelets)).empty();
 }
 
 auto ActionNode::calculateUpdatedEntityStatus(
@@ -521,11 +513,16 @@ auto ActionNode::calculateStopDistance(
 
 auto ActionNode::getActionStatus() const noexcept -> traffic_simulator_msgs::msg::ActionStatus
 {
-  return static_cast<traffic_simulator::EntityStatus>(*entity_status).action_status;
+  return static_cast<const traffic_simulator::EntityStatus &>(*entity_status).action_status;
 }
 
 auto ActionNode::getEntityName() const noexcept -> std::string
 {
-  return static_cast<traffic_simulator::EntityStatus>(*entity_status).name;
+  return static_cast<const traffic_simulator::EntityStatus &>(*entity_status).name;
+}
+
+auto ActionNode::getEntityId() const -> std::optional<traffic_simulator::EntityId>
+{
+  return other_entity_status->getEntityId(entity_status->getName());
 }
 }  // namespace entity_behavior
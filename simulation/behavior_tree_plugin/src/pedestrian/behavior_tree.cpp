@@ -19,6 +19,8 @@
 #include <iostream>
 #include <memory>
 #include <pugixml.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -26,14 +28,9 @@ namespace entity_behavior
 {
 void PedestrianBehaviorTree::configure(const rclcpp::Logger & logger)
 {
-  namespace pedestrian = entity_behavior::pedestrian;
-  factory_.registerNodeType<pedestrian::FollowLaneAction>("FollowLane");
-  factory_.registerNodeType<pedestrian::WalkStraightAction>("WalkStraightAction");
-  factory_.registerNodeType<pedestrian::FollowPolylineTrajectoryAction>("FollowPolylineTrajectory");
-
-  auto base_path = ament_index_cpp::get_package_share_directory("behavior_tree_plugin");
-  auto format_path = base_path + "/config/pedestrian_entity_behavior.xml";
-  tree_ = createBehaviorTree(format_path);
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set<std::shared_ptr<const ActionNodeContext>>(ActionNodeContext::key(), context_);
+  tree_ = getFactory().createTreeFromText(getTreeText(), blackboard);
   logging_event_ptr_ =
     std::make_unique<behavior_tree_plugin::LoggingEvent>(tree_.rootNode(), logger);
   reset_request_event_ptr_ = std::make_unique<behavior_tree_plugin::ResetRequestEvent>(
@@ -42,40 +39,76 @@ void PedestrianBehaviorTree::configure(const rclcpp::Logger & logger)
   setRequest(traffic_simulator::behavior::Request::NONE);
 }
 
-auto PedestrianBehaviorTree::createBehaviorTree(const std::string & format_path) -> BT::Tree
+/// @note Node types do not depend on the entity, so they are registered once per process.
+auto PedestrianBehaviorTree::getFactory() -> BT::BehaviorTreeFactory &
 {
-  auto xml_doc = pugi::xml_document();
-  xml_doc.load_file(format_path.c_str());
+  static auto factory = []() {
+    namespace pedestrian = entity_behavior::pedestrian;
+    auto factory = BT::BehaviorTreeFactory();
+    factory.registerNodeType<pedestrian::FollowLaneAction>("FollowLane");
+    factory.registerNodeType<pedestrian::WalkStraightAction>("WalkStraightAction");
+    factory.registerNodeType<pedestrian::FollowPolylineTrajectoryAction>(
+      "FollowPolylineTrajectory");
+    return factory;
+  }();
+  return factory;
+}
 
-  class XMLTreeWalker : public pugi::xml_tree_walker
-  {
-  public:
-    explicit XMLTreeWalker(const BT::TreeNodeManifest & manifest) : manifest_(manifest) {}
+/// @note The tree text is loaded and its ports are bound to the blackboard once per process.
+auto PedestrianBehaviorTree::getTreeText() -> const std::string &
+{
+  static const auto tree_text = []() {
+    const auto format_path = ament_index_cpp::get_package_share_directory("behavior_tree_plugin") +
+                             "/config/pedestrian_entity_behavior.xml";
+    auto xml_doc = pugi::xml_document();
+    xml_doc.load_file(format_path.c_str());
 
-  private:
-    bool for_each(pugi::xml_node & node) final
+    class XMLTreeWalker : public pugi::xml_tree_walker
     {
-      if (node.name() == manifest_.registration_ID) {
-        for (const auto & [port, info] : manifest_.ports) {
-          node.append_attribute(port.c_str()) = std::string("{" + port + "}").c_str();
+    public:
+      explicit XMLTreeWalker(const BT::TreeNodeManifest & manifest) : manifest_(manifest) {}
+
+    private:
+      bool for_each(pugi::xml_node & node) final
+      {
+        if (node.name() == manifest_.registration_ID) {
+          for (const auto & [port, info] : manifest_.ports) {
+            node.append_attribute(port.c_str()) = std::string("{" + port + "}").c_str();
+          }
         }
+        return true;
       }
-      return true;
-    }
 
-    const BT::TreeNodeManifest & manifest_;
-  };
+      const BT::TreeNodeManifest & manifest_;
+    };
 
-  for (const auto & [id, manifest] : factory_.manifests()) {
-    if (factory_.builtinNodes().count(id) == 0) {
-      auto walker = XMLTreeWalker(manifest);
-      xml_doc.traverse(walker);
+    const auto & factory = getFactory();
+    for (const auto & [id, manifest] : factory.manifests()) {
+      if (factory.builtinNodes().count(id) == 0) {
+        auto walker = XMLTreeWalker(manifest);
+        xml_doc.traverse(walker);
+      }
     }
+
+    auto xml_str = std::stringstream();
+    xml_doc.save(xml_str);
+    return xml_str.str();
+  }();
+  return tree_text;
+}
+
+auto PedestrianBehaviorTree::getLaneChangeParameters() -> traffic_simulator::lane_change::Parameter
+{
+  if (context_->lane_change_parameters) {
+    return context_->lane_change_parameters.value();
   }
+  THROW_SIMULATION_ERROR("lane change parameters are not set.");
+}
 
-  auto xml_str = std::stringstream();
-  xml_doc.save(xml_str);
-  return factory_.createTreeFromText(xml_str.str());
+auto PedestrianBehaviorTree::setLaneChangeParameters(
+  const traffic_simulator::lane_change::Parameter & lane_change_parameters) -> void
+{
+  context_->lane_change_parameters = lane_change_parameters;
 }
 
 const std::string & PedestrianBehaviorTree::getCurrentAction() const
@@ -30,11 +30,11 @@ FollowLaneAction::FollowLaneAction(const std::string & name, const BT::NodeConfi
 {
 }
 
-void FollowLaneAction::getBlackBoardValues() { PedestrianActionNode::getBlackBoardValues(); }
+void FollowLaneAction::validateInputs() { PedestrianActionNode::validateInputs(); }
 
 BT::NodeStatus FollowLaneAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
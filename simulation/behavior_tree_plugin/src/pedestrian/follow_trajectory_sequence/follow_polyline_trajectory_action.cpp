@@ -46,25 +46,15 @@ auto FollowPolylineTrajectoryAction::calculateObstacle(
   return std::nullopt;
 }
 
-auto FollowPolylineTrajectoryAction::providedPorts() -> BT::PortsList
-{
-  auto ports = PedestrianActionNode::providedPorts();
-  ports.emplace(BT::InputPort<decltype(polyline_trajectory)>("polyline_trajectory"));
-  ports.emplace(BT::InputPort<decltype(target_speed)>("target_speed"));
-  return ports;
-}
-
 auto FollowPolylineTrajectoryAction::tick() -> BT::NodeStatus
 {
-  if (getBlackBoardValues();
+  if (validateInputs();
       request != traffic_simulator::behavior::Request::FOLLOW_POLYLINE_TRAJECTORY or
-      not getInput<decltype(polyline_trajectory)>("polyline_trajectory", polyline_trajectory) or
-      not getInput<decltype(target_speed)>("target_speed", target_speed) or
       not polyline_trajectory) {
     return BT::NodeStatus::FAILURE;
   } else if (
     const auto updated_status = traffic_simulator::follow_trajectory::makeUpdatedStatus(
-      static_cast<traffic_simulator::EntityStatus>(*entity_status), *polyline_trajectory,
+      static_cast<const traffic_simulator::EntityStatus &>(*entity_status), *polyline_trajectory,
       behavior_parameter, step_time, target_speed)) {
     setOutput(
       "updated_status",
@@ -23,19 +23,16 @@ namespace entity_behavior
 {
 PedestrianActionNode::PedestrianActionNode(
   const std::string & name, const BT::NodeConfiguration & config)
-: ActionNode(name, config)
+: ActionNode(name, config),
+  pedestrian_parameters(context->pedestrian_parameters),
+  behavior_parameter(context->behavior_parameter)
 {
 }
 
-void PedestrianActionNode::getBlackBoardValues()
+void PedestrianActionNode::validateInputs()
 {
-  ActionNode::getBlackBoardValues();
-  if (!getInput<traffic_simulator_msgs::msg::BehaviorParameter>(
-        "behavior_parameter", behavior_parameter)) {
-    behavior_parameter = traffic_simulator_msgs::msg::BehaviorParameter();
-  }
-  if (!getInput<traffic_simulator_msgs::msg::PedestrianParameters>(
-        "pedestrian_parameters", pedestrian_parameters)) {
+  ActionNode::validateInputs();
+  if (not context->pedestrian_parameters_is_set) {
     THROW_SIMULATION_ERROR("failed to get input pedestrian_parameters in PedestrianActionNode");
   }
 }
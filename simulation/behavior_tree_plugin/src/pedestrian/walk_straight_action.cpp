@@ -36,11 +36,11 @@ WalkStraightAction::WalkStraightAction(
 {
 }
 
-void WalkStraightAction::getBlackBoardValues() { PedestrianActionNode::getBlackBoardValues(); }
+void WalkStraightAction::validateInputs() { PedestrianActionNode::validateInputs(); }
 
 BT::NodeStatus WalkStraightAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (request != traffic_simulator::behavior::Request::WALK_STRAIGHT) {
     return BT::NodeStatus::FAILURE;
   }
@@ -25,7 +25,9 @@
 #include <behavior_tree_plugin/vehicle/follow_trajectory_sequence/follow_polyline_trajectory_action.hpp>
 #include <behavior_tree_plugin/vehicle/lane_change_action.hpp>
 #include <iostream>
+#include <memory>
 #include <pugixml.hpp>
+#include <scenario_simulator_exception/exception.hpp>
 #include <sstream>
 #include <string>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
@@ -35,22 +37,9 @@ namespace entity_behavior
 {
 void VehicleBehaviorTree::configure(const rclcpp::Logger & logger)
 {
-  factory_.registerNodeType<vehicle::follow_lane_sequence::FollowLaneAction>("FollowLane");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::FollowFrontEntityAction>(
-    "FollowFrontEntity");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::StopAtCrossingEntityAction>(
-    "StopAtCrossingEntity");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::StopAtStopLineAction>("StopAtStopLine");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::StopAtTrafficLightAction>(
-    "StopAtTrafficLight");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::YieldAction>("Yield");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::MoveBackwardAction>("MoveBackward");
-  factory_.registerNodeType<vehicle::FollowPolylineTrajectoryAction>("FollowPolylineTrajectory");
-  factory_.registerNodeType<vehicle::LaneChangeAction>("LaneChange");
-
-  tree_ = createBehaviorTree(
-    ament_index_cpp::get_package_share_directory("behavior_tree_plugin") +
-    "/config/vehicle_entity_behavior.xml");
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set<std::shared_ptr<const ActionNodeContext>>(ActionNodeContext::key(), context_);
+  tree_ = getFactory().createTreeFromText(getTreeText(), blackboard);
 
   logging_event_ptr_ =
     std::make_unique<behavior_tree_plugin::LoggingEvent>(tree_.rootNode(), logger);
@@ -62,46 +51,79 @@ void VehicleBehaviorTree::configure(const rclcpp::Logger & logger)
   setRequest(traffic_simulator::behavior::Request::NONE);
 }
 
-auto VehicleBehaviorTree::createBehaviorTree(const std::string & format_path) -> BT::Tree
+/// @note Node types do not depend on the entity, so they are registered once per process.
+auto VehicleBehaviorTree::getFactory() -> BT::BehaviorTreeFactory &
 {
-  auto xml_doc = pugi::xml_document();
-  xml_doc.load_file(format_path.c_str());
+  static auto factory = []() {
+    auto factory = BT::BehaviorTreeFactory();
+    factory.registerNodeType<vehicle::follow_lane_sequence::FollowLaneAction>("FollowLane");
+    factory.registerNodeType<vehicle::follow_lane_sequence::FollowFrontEntityAction>(
+      "FollowFrontEntity");
+    factory.registerNodeType<vehicle::follow_lane_sequence::StopAtCrossingEntityAction>(
+      "StopAtCrossingEntity");
+    factory.registerNodeType<vehicle::follow_lane_sequence::StopAtStopLineAction>(
+      "StopAtStopLine");
+    factory.registerNodeType<vehicle::follow_lane_sequence::StopAtTrafficLightAction>(
+      "StopAtTrafficLight");
+    factory.registerNodeType<vehicle::follow_lane_sequence::YieldAction>("Yield");
+    factory.registerNodeType<vehicle::follow_lane_sequence::MoveBackwardAction>("MoveBackward");
+    factory.registerNodeType<vehicle::FollowPolylineTrajectoryAction>("FollowPolylineTrajectory");
+    factory.registerNodeType<vehicle::LaneChangeAction>("LaneChange");
+    return factory;
+  }();
+  return factory;
+}
 
-  class XMLTreeWalker : public pugi::xml_tree_walker
-  {
-  public:
-    explicit XMLTreeWalker(const BT::TreeNodeManifest & manifest) : manifest_(manifest) {}
+/**
+ * @note The tree text is loaded and rewritten to bind every port of the registered nodes to the
+ * blackboard entry of the same name only once per process, so that spawning an entity only parses
+ * the cached text and instantiates the nodes.
+ */
+auto VehicleBehaviorTree::getTreeText() -> const std::string &
+{
+  static const auto tree_text = []() {
+    const auto format_path = ament_index_cpp::get_package_share_directory("behavior_tree_plugin") +
+                             "/config/vehicle_entity_behavior.xml";
+    auto xml_doc = pugi::xml_document();
+    xml_doc.load_file(format_path.c_str());
 
-  private:
-    bool for_each(pugi::xml_node & node) final
+    class XMLTreeWalker : public pugi::xml_tree_walker
     {
-      if (node.name() == manifest_.registration_ID) {
-        for (const auto & [port, info] : manifest_.ports) {
-          node.append_attribute(port.c_str()) = std::string("{" + port + "}").c_str();
+    public:
+      explicit XMLTreeWalker(const BT::TreeNodeManifest & manifest) : manifest_(manifest) {}
+
+    private:
+      bool for_each(pugi::xml_node & node) final
+      {
+        if (node.name() == manifest_.registration_ID) {
+          for (const auto & [port, info] : manifest_.ports) {
+            node.append_attribute(port.c_str()) = std::string("{" + port + "}").c_str();
+          }
         }
+        return true;
       }
-      return true;
-    }
 
-    const BT::TreeNodeManifest & manifest_;
-  };
+      const BT::TreeNodeManifest & manifest_;
+    };
 
-  for (const auto & [id, manifest] : factory_.manifests()) {
-    if (factory_.builtinNodes().count(id) == 0) {
-      auto walker = XMLTreeWalker(manifest);
-      xml_doc.traverse(walker);
+    const auto & factory = getFactory();
+    for (const auto & [id, manifest] : factory.manifests()) {
+      if (factory.builtinNodes().count(id) == 0) {
+        auto walker = XMLTreeWalker(manifest);
+        xml_doc.traverse(walker);
+      }
     }
-  }
 
-  auto xml_str = std::stringstream();
-  xml_doc.save(xml_str);
-  return factory_.createTreeFromText(xml_str.str());
+    auto xml_str = std::stringstream();
+    xml_doc.save(xml_str);
+    return xml_str.str();
+  }();
+  return tree_text;
 }
 
 auto VehicleBehaviorTree::getBehaviorParameter() -> traffic_simulator_msgs::msg::BehaviorParameter
 {
-  return tree_.rootBlackboard()->get<traffic_simulator_msgs::msg::BehaviorParameter>(
-    getBehaviorParameterKey());
+  return context_->behavior_parameter;
 }
 
 auto VehicleBehaviorTree::setBehaviorParameter(
@@ -133,8 +155,21 @@ auto VehicleBehaviorTree::setBehaviorParameter(
     return result;
   };
 
-  tree_.rootBlackboard()->set<traffic_simulator_msgs::msg::BehaviorParameter>(
-    getBehaviorParameterKey(), clamp(behavior_parameter));
+  context_->behavior_parameter = clamp(behavior_parameter);
+}
+
+auto VehicleBehaviorTree::getLaneChangeParameters() -> traffic_simulator::lane_change::Parameter
+{
+  if (context_->lane_change_parameters) {
+    return context_->lane_change_parameters.value();
+  }
+  THROW_SIMULATION_ERROR("lane change parameters are not set.");
+}
+
+auto VehicleBehaviorTree::setLaneChangeParameters(
+  const traffic_simulator::lane_change::Parameter & lane_change_parameters) -> void
+{
+  context_->lane_change_parameters = lane_change_parameters;
 }
 
 const std::string & VehicleBehaviorTree::getCurrentAction() const
@@ -71,7 +71,7 @@ const traffic_simulator_msgs::msg::WaypointsArray FollowFrontEntityAction::calcu
 
 BT::NodeStatus FollowFrontEntityAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
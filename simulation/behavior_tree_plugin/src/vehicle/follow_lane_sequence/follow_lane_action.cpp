@@ -55,10 +55,10 @@ const traffic_simulator_msgs::msg::WaypointsArray FollowLaneAction::calculateWay
   }
 }
 
-void FollowLaneAction::getBlackBoardValues()
+void FollowLaneAction::validateInputs()
 {
   traffic_simulator::LaneletPose target_lanelet_pose;
-  VehicleActionNode::getBlackBoardValues();
+  VehicleActionNode::validateInputs();
   if (!getInput<traffic_simulator::LaneletPose>("target_lanelet_pose", target_lanelet_pose)) {
     target_lanelet_pose_ = std::nullopt;
   } else {
@@ -68,7 +68,7 @@ void FollowLaneAction::getBlackBoardValues()
 
 BT::NodeStatus FollowLaneAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
@@ -60,11 +60,11 @@ const traffic_simulator_msgs::msg::WaypointsArray MoveBackwardAction::calculateW
   return waypoints;
 }
 
-void MoveBackwardAction::getBlackBoardValues() { VehicleActionNode::getBlackBoardValues(); }
+void MoveBackwardAction::validateInputs() { VehicleActionNode::validateInputs(); }
 
 BT::NodeStatus MoveBackwardAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
@@ -85,7 +85,7 @@ std::optional<double> StopAtCrossingEntityAction::calculateTargetSpeed(double cu
 
 BT::NodeStatus StopAtCrossingEntityAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
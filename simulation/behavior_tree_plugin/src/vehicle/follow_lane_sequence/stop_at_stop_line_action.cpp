@@ -88,7 +88,7 @@ std::optional<double> StopAtStopLineAction::calculateTargetSpeed(double current_
 
 BT::NodeStatus StopAtStopLineAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
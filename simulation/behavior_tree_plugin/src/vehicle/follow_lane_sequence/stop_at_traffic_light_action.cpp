@@ -86,7 +86,7 @@ std::optional<double> StopAtTrafficLightAction::calculateTargetSpeed(double curr
 
 BT::NodeStatus StopAtTrafficLightAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
@@ -87,7 +87,7 @@ std::optional<double> YieldAction::calculateTargetSpeed()
 
 BT::NodeStatus YieldAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (
     request != traffic_simulator::behavior::Request::NONE &&
     request != traffic_simulator::behavior::Request::FOLLOW_LANE) {
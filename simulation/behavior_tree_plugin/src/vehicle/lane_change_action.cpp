@@ -75,21 +75,15 @@ const traffic_simulator_msgs::msg::WaypointsArray LaneChangeAction::calculateWay
   }
 }
 
-void LaneChangeAction::getBlackBoardValues()
+void LaneChangeAction::validateInputs()
 {
-  VehicleActionNode::getBlackBoardValues();
-  traffic_simulator::lane_change::Parameter lane_change_parameters;
-  if (!getInput<traffic_simulator::lane_change::Parameter>(
-        "lane_change_parameters", lane_change_parameters)) {
-    lane_change_parameters_ = std::nullopt;
-  } else {
-    lane_change_parameters_ = lane_change_parameters;
-  }
+  VehicleActionNode::validateInputs();
+  lane_change_parameters_ = context->lane_change_parameters;
 }
 
 BT::NodeStatus LaneChangeAction::tick()
 {
-  getBlackBoardValues();
+  validateInputs();
   if (request != traffic_simulator::behavior::Request::LANE_CHANGE) {
     curve_ = std::nullopt;
     current_s_ = 0;
@@ -0,0 +1,127 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <behavior_tree_plugin/pedestrian/behavior_tree.hpp>
+#include <behavior_tree_plugin/vehicle/behavior_tree.hpp>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
+
+namespace
+{
+auto makeHdMapUtils() -> std::shared_ptr<hdmap_utils::HdMapUtils>
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  return std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+}
+
+/**
+ * @brief Set the inputs every action node needs, leaving out the ones without a default value.
+ * @note The entity is not matched to any lanelet, so the first node following the lane only stops
+ * the entity and outputs the status it was given.
+ */
+auto setCommonInputs(entity_behavior::BehaviorPluginBase & behavior_tree)
+  -> std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>
+{
+  const auto hdmap_utils = makeHdMapUtils();
+  traffic_simulator::EntityStatus status;
+  status.name = "ego";
+  status.lanelet_pose_valid = false;
+  status.action_status.twist.linear.x = 3.0;
+  const auto entity_status =
+    std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(status, hdmap_utils);
+  behavior_tree.setHdMapUtils(hdmap_utils);
+  behavior_tree.setTrafficLightManager(
+    std::make_shared<traffic_simulator::TrafficLightManager>(hdmap_utils));
+  behavior_tree.setEntityStatus(entity_status);
+  behavior_tree.setOtherEntityStatus(
+    std::make_shared<const traffic_simulator::entity::EntityStatusSnapshot>());
+  return entity_status;
+}
+
+auto updateError(entity_behavior::BehaviorPluginBase & behavior_tree) -> std::string
+{
+  try {
+    behavior_tree.update(0.0, 0.1);
+  } catch (const common::SimulationError & error) {
+    return error.what();
+  }
+  return "";
+}
+}  // namespace
+
+TEST(ActionNodeInputs, VehicleSeesPluginSetters)
+{
+  auto behavior_tree = entity_behavior::VehicleBehaviorTree();
+  behavior_tree.configure(rclcpp::get_logger("vehicle"));
+  const auto entity_status = setCommonInputs(behavior_tree);
+  behavior_tree.setVehicleParameters(traffic_simulator_msgs::msg::VehicleParameters());
+  behavior_tree.setReferenceTrajectory(nullptr);
+  behavior_tree.update(0.0, 0.1);
+  EXPECT_EQ(behavior_tree.getCurrentAction(), "follow_lane");
+  EXPECT_EQ(behavior_tree.getUpdatedStatus(), entity_status);
+  EXPECT_DOUBLE_EQ(entity_status->getTwist().linear.x, 0.0);
+}
+
+TEST(ActionNodeInputs, VehicleRequiresVehicleParameters)
+{
+  auto behavior_tree = entity_behavior::VehicleBehaviorTree();
+  behavior_tree.configure(rclcpp::get_logger("vehicle"));
+  setCommonInputs(behavior_tree);
+  behavior_tree.setReferenceTrajectory(nullptr);
+  EXPECT_NE(updateError(behavior_tree).find("vehicle_parameters"), std::string::npos);
+}
+
+TEST(ActionNodeInputs, VehicleRequiresReferenceTrajectory)
+{
+  auto behavior_tree = entity_behavior::VehicleBehaviorTree();
+  behavior_tree.configure(rclcpp::get_logger("vehicle"));
+  setCommonInputs(behavior_tree);
+  behavior_tree.setVehicleParameters(traffic_simulator_msgs::msg::VehicleParameters());
+  EXPECT_NE(updateError(behavior_tree).find("reference_trajectory"), std::string::npos);
+}
+
+TEST(ActionNodeInputs, PedestrianSeesPluginSetters)
+{
+  auto behavior_tree = entity_behavior::PedestrianBehaviorTree();
+  behavior_tree.configure(rclcpp::get_logger("pedestrian"));
+  const auto entity_status = setCommonInputs(behavior_tree);
+  behavior_tree.setPedestrianParameters(traffic_simulator_msgs::msg::PedestrianParameters());
+  behavior_tree.update(0.0, 0.1);
+  EXPECT_EQ(behavior_tree.getCurrentAction(), "follow_lane");
+  EXPECT_EQ(behavior_tree.getUpdatedStatus(), entity_status);
+  EXPECT_DOUBLE_EQ(entity_status->getTwist().linear.x, 0.0);
+}
+
+TEST(ActionNodeInputs, PedestrianRequiresPedestrianParameters)
+{
+  auto behavior_tree = entity_behavior::PedestrianBehaviorTree();
+  behavior_tree.configure(rclcpp::get_logger("pedestrian"));
+  setCommonInputs(behavior_tree);
+  EXPECT_NE(updateError(behavior_tree).find("pedestrian_parameters"), std::string::npos);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
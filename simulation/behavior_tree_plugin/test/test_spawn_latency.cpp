@@ -0,0 +1,93 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <behavior_tree_plugin/pedestrian/behavior_tree.hpp>
+#include <behavior_tree_plugin/vehicle/behavior_tree.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+constexpr std::size_t number_of_entities = 100;
+
+/**
+ * @brief Configure behavior trees the same way the traffic simulator does when entities are spawned
+ * and report the latency of the first spawn and the average latency of the following ones.
+ */
+template <typename BehaviorTree>
+auto measureSpawnLatency(const std::string & name) -> std::vector<std::unique_ptr<BehaviorTree>>
+{
+  using Duration = std::chrono::duration<double, std::micro>;
+
+  auto behavior_trees = std::vector<std::unique_ptr<BehaviorTree>>();
+  auto first_spawn_latency = Duration::zero();
+  auto total_latency = Duration::zero();
+  for (std::size_t i = 0; i < number_of_entities; ++i) {
+    const auto begin = std::chrono::steady_clock::now();
+    auto behavior_tree = std::make_unique<BehaviorTree>();
+    behavior_tree->configure(rclcpp::get_logger(name + std::to_string(i)));
+    const auto latency = Duration(std::chrono::steady_clock::now() - begin);
+    if (i == 0) {
+      first_spawn_latency = latency;
+    } else {
+      total_latency += latency;
+    }
+    behavior_trees.push_back(std::move(behavior_tree));
+  }
+  const auto average_latency = total_latency / (number_of_entities - 1);
+  std::cout << name << " spawn latency : first " << first_spawn_latency.count() << " us, average "
+            << average_latency.count() << " us" << std::endl;
+  testing::Test::RecordProperty(
+    name + "_first_spawn_latency_us", std::to_string(first_spawn_latency.count()));
+  testing::Test::RecordProperty(
+    name + "_average_spawn_latency_us", std::to_string(average_latency.count()));
+  return behavior_trees;
+}
+
+TEST(SpawnLatency, Vehicle)
+{
+  const auto behavior_trees = measureSpawnLatency<entity_behavior::VehicleBehaviorTree>("vehicle");
+  ASSERT_EQ(behavior_trees.size(), number_of_entities);
+}
+
+TEST(SpawnLatency, Pedestrian)
+{
+  const auto behavior_trees =
+    measureSpawnLatency<entity_behavior::PedestrianBehaviorTree>("pedestrian");
+  ASSERT_EQ(behavior_trees.size(), number_of_entities);
+}
+
+/**
+ * @note Trees instantiated from the shared template must not share their inputs.
+ */
+TEST(SpawnLatency, IndependentInputs)
+{
+  auto behavior_tree_0 = entity_behavior::VehicleBehaviorTree();
+  auto behavior_tree_1 = entity_behavior::VehicleBehaviorTree();
+  behavior_tree_0.configure(rclcpp::get_logger("vehicle0"));
+  behavior_tree_1.configure(rclcpp::get_logger("vehicle1"));
+  behavior_tree_0.setCurrentTime(1.0);
+  behavior_tree_1.setCurrentTime(2.0);
+  EXPECT_DOUBLE_EQ(behavior_tree_0.getCurrentTime(), 1.0);
+  EXPECT_DOUBLE_EQ(behavior_tree_1.getCurrentTime(), 2.0);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
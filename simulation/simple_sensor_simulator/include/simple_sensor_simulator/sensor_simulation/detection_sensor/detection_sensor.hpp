@@ -22,6 +22,7 @@
 #include <random>
 #include <rclcpp/rclcpp.hpp>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -47,10 +48,7 @@ protected:
 
   auto filterObjectsBySensorRange(
     const std::vector<traffic_simulator_msgs::EntityStatus> &, const std::vector<std::string> &,
-    const double) const -> std::vector<std::string>;
-
-  auto getEntityPose(const std::vector<traffic_simulator_msgs::EntityStatus> &, const std::string &)
-    const -> geometry_msgs::Pose;
+    const double) const -> std::unordered_set<std::string>;
 
   auto getDetectedObjects(const std::vector<traffic_simulator_msgs::EntityStatus> &) const
     -> std::vector<std::string>;
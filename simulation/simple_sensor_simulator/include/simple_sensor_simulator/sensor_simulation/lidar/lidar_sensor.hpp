@@ -23,6 +23,7 @@
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace simple_sensor_simulator
@@ -59,10 +60,13 @@ class LidarSensor : public LidarSensorBase
 {
   const typename rclcpp::Publisher<T>::SharedPtr publisher_ptr_;
 
-  std::queue<std::pair<sensor_msgs::msg::PointCloud2, double>> queue_pointcloud_;
+  std::queue<std::pair<T, double>> queue_pointcloud_;
 
-  auto raycast(const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-    -> T;
+  /// @note Point cloud published last, whose data buffer is reused by the next scan.
+  T recycled_pointcloud_;
+
+  auto raycast(
+    const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &, T &) -> void;
 
 public:
   explicit LidarSensor(
@@ -83,8 +87,17 @@ public:
       current_simulation_time - previous_simulation_time_ - configuration_.scan_duration() >=
       -0.002) {
       previous_simulation_time_ = current_simulation_time;
-      queue_pointcloud_.push(
-        std::make_pair(raycast(status, current_ros_time), current_simulation_time));
+      if (
+        queue_pointcloud_.empty() and configuration_.lidar_sensor_delay() <= 0 and
+        publisher_ptr_->can_loan_messages()) {
+        /// @note The point cloud is published right away, so it is written into middleware memory.
+        auto loaned_pointcloud = publisher_ptr_->borrow_loaned_message();
+        raycast(status, current_ros_time, loaned_pointcloud.get());
+        publisher_ptr_->publish(std::move(loaned_pointcloud));
+        return;
+      }
+      raycast(status, current_ros_time, recycled_pointcloud_);
+      queue_pointcloud_.emplace(std::move(recycled_pointcloud_), current_simulation_time);
     } else {
       detected_objects_.clear();
     }
@@ -93,21 +106,17 @@ public:
       not queue_pointcloud_.empty() and
       current_simulation_time - queue_pointcloud_.front().second >=
         configuration_.lidar_sensor_delay()) {
-      const auto pointcloud = queue_pointcloud_.front().first;
+      publisher_ptr_->publish(queue_pointcloud_.front().first);
+      recycled_pointcloud_ = std::move(queue_pointcloud_.front().first);
       queue_pointcloud_.pop();
-      publisher_ptr_->publish(pointcloud);
     }
   }
-
-private:
-  // Override
-  Raycaster raycaster_;
 };
 
 template <>
 auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
-  const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-  -> sensor_msgs::msg::PointCloud2;
+  const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
+  sensor_msgs::msg::PointCloud2 &) -> void;
 }  // namespace simple_sensor_simulator
 
 #endif  // SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__LIDAR__LIDAR_SENSOR_HPP_
@@ -16,17 +16,21 @@
 #define SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__LIDAR__RAYCASTER_HPP_
 
 #include <embree3/rtcore.h>
-#include <pcl_conversions/pcl_conversions.h>
 #include <quaternion_operation/quaternion_operation.h>
 
+#include <cmath>
+#include <cstddef>
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/vector3.hpp>
 #include <memory>
 #include <random>
+#include <rclcpp/time.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
+#include <set>
 #include <simple_sensor_simulator/sensor_simulation/primitives/box.hpp>
 #include <simple_sensor_simulator/sensor_simulation/primitives/primitive.hpp>
 #include <string>
+#include <traffic_simulator/helper/thread_pool.hpp>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -39,18 +43,25 @@ public:
   Raycaster();
   explicit Raycaster(std::string embree_config);
   ~Raycaster();
-  template <typename T, typename... Ts>
-  void addPrimitive(std::string name, Ts &&... xs)
-  {
-    if (primitive_ptrs_.count(name) != 0) {
-      throw std::runtime_error("primitive " + name + " already exist.");
-    }
-    auto primitive_ptr = std::make_unique<T>(std::forward<Ts>(xs)...);
-    primitive_ptrs_.emplace(name, std::move(primitive_ptr));
-  }
-  const sensor_msgs::msg::PointCloud2 raycast(
+  /**
+   * @brief Place the box of the entity for the next raycast.
+   * @note Every box is an instance of one shared unit box mesh, so placing a box that was placed
+   * for the previous raycast only updates its transform. Boxes which were not placed before a
+   * raycast are removed from the scene by the raycast.
+   */
+  void addBox(
+    const std::string & name, float depth, float width, float height,
+    const geometry_msgs::msg::Pose & pose);
+  sensor_msgs::msg::PointCloud2 raycast(
     const std::string & frame_id, const rclcpp::Time & stamp,
     const geometry_msgs::msg::Pose & origin, double max_distance = 300, double min_distance = 0);
+  /**
+   * @brief Raycast into the given point cloud, reusing the memory of its data buffer.
+   */
+  void raycast(
+    sensor_msgs::msg::PointCloud2 & pointcloud_msg, const std::string & frame_id,
+    const rclcpp::Time & stamp, const geometry_msgs::msg::Pose & origin, double max_distance = 300,
+    double min_distance = 0);
   const std::vector<std::string> & getDetectedObject() const;
   void setDirection(
     const simulation_api_schema::LidarConfiguration & configuration,
@@ -65,57 +76,30 @@ private:
   double previous_horizontal_angle_end_;
   double previous_horizontal_resolution_;
   std::vector<double> previous_vertical_angles_;
-  std::unordered_map<std::string, std::unique_ptr<primitives::Primitive>> primitive_ptrs_;
   RTCDevice device_;
   RTCScene scene_;
+  RTCScene box_scene_;
+  struct BoxInstance
+  {
+    RTCGeometry geometry;
+    unsigned int geometry_id;
+    bool placed;
+  };
+  std::unordered_map<std::string, BoxInstance> box_instances_;
   std::random_device seed_gen_;
   std::default_random_engine engine_;
   std::vector<std::string> detected_objects_;
   std::unordered_map<unsigned int, std::string> geometry_ids_;
-  std::vector<Eigen::Matrix3d> rotation_matrices_;
-
-  static void intersect(
-    int thread_id, int thread_count, RTCScene scene,
-    pcl::PointCloud<pcl::PointXYZI>::Ptr thread_cloud, RTCIntersectContext context,
-    geometry_msgs::msg::Pose origin,
-    std::reference_wrapper<std::set<unsigned int>> ref_thread_detected_ids, double max_distance,
-    double min_distance,
-    std::reference_wrapper<const std::vector<Eigen::Matrix3d>> ref_rotation_matrices)
-  {
-    auto & rotation_matrices = ref_rotation_matrices.get();
-    auto & thread_detected_ids = ref_thread_detected_ids.get();
-    const auto orientation_matrix = quaternion_operation::getRotationMatrix(origin.orientation);
-    for (unsigned int i = thread_id; i < rotation_matrices.size(); i += thread_count) {
-      RTCRayHit rayhit = {};
-      rayhit.ray.org_x = origin.position.x;
-      rayhit.ray.org_y = origin.position.y;
-      rayhit.ray.org_z = origin.position.z;
-      // make raycast interact with all objects
-      rayhit.ray.mask = 0b11111111'11111111'11111111'11111111;
-      rayhit.ray.tfar = max_distance;
-      rayhit.ray.tnear = min_distance;
-      rayhit.ray.flags = false;
-
-      const auto rotation_mat = orientation_matrix * rotation_matrices.at(i);
-      rayhit.ray.dir_x = rotation_mat(0);
-      rayhit.ray.dir_y = rotation_mat(1);
-      rayhit.ray.dir_z = rotation_mat(2);
-      rayhit.hit.geomID = RTC_INVALID_GEOMETRY_ID;
-      rtcIntersect1(scene, &context, &rayhit);
-
-      if (rayhit.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-        double distance = rayhit.ray.tfar;
-        pcl::PointXYZI p;
-        {
-          p.x = rotation_matrices.at(i)(0) * distance;
-          p.y = rotation_matrices.at(i)(1) * distance;
-          p.z = rotation_matrices.at(i)(2) * distance;
-        }
-        thread_cloud->emplace_back(p);
-        thread_detected_ids.insert(rayhit.hit.geomID);
-      }
-    }
-  }
+  /// @note Directions of rays in the sensor frame, stored as separate arrays for each axis.
+  std::vector<float> direction_x_;
+  std::vector<float> direction_y_;
+  std::vector<float> direction_z_;
+  /// @note Rays of a chunk are intersected as one stream and the chunk is the unit of parallelism.
+  static constexpr std::size_t chunk_size = 256;
+  std::vector<RTCRayHit> rayhits_;
+  std::vector<std::size_t> chunk_hit_counts_;
+  std::vector<std::set<unsigned int>> chunk_detected_ids_;
+  traffic_simulator::helper::ThreadPool thread_pool_;
 };
 }  // namespace simple_sensor_simulator
 
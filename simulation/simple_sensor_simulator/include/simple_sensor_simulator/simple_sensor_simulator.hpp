@@ -18,6 +18,7 @@
 #include <tf2/LinearMath/Quaternion.h>
 #include <tf2_ros/transform_broadcaster.h>
 
+#include <cstdint>
 #include <geographic_msgs/msg/geo_point.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/transform_stamped.hpp>
@@ -32,6 +33,7 @@
 #include <string>
 #include <thread>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <unordered_map>
 #include <vector>
 #include <visualization_msgs/msg/marker_array.hpp>
 
@@ -104,8 +106,8 @@ private:
 
   template <typename SpawnRequestType>
   auto insertEntitySpawnedStatus(
-    const SpawnRequestType & spawn_request, const traffic_simulator_msgs::EntityType::Enum & type,
-    const traffic_simulator_msgs::EntitySubtype::Enum & subtype) -> void;
+    const SpawnRequestType & spawn_request, const traffic_simulator_msgs::EntityType::Enum & type)
+    -> void;
 
   auto spawnPedestrianEntity(const simulation_api_schema::SpawnPedestrianEntityRequest &)
     -> simulation_api_schema::SpawnPedestrianEntityResponse;
@@ -147,6 +149,7 @@ private:
   rclcpp::Time current_ros_time_;
   bool initialized_;
   std::map<std::string, simulation_api_schema::EntityStatus> entity_status_;
+  std::unordered_map<std::uint32_t, std::string> entity_names_;
   simulation_api_schema::UpdateTrafficLightsRequest traffic_signals_states_;
   traffic_simulator_msgs::BoundingBox getBoundingBox(const std::string & name);
   zeromq::MultiServer server_;
@@ -27,6 +27,8 @@
 #include <simple_sensor_simulator/sensor_simulation/detection_sensor/detection_sensor.hpp>
 #include <simulation_interface/conversions.hpp>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace simple_sensor_simulator
@@ -56,22 +58,6 @@ auto DetectionSensorBase::getSensorPose(
   throw SimulationRuntimeError("Detection sensor can be attached only ego entity.");
 }
 
-auto DetectionSensorBase::getEntityPose(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & entity_statuses,
-  const std::string & entity_string) const -> geometry_msgs::Pose
-{
-  for (const auto & entity_status : entity_statuses) {
-    if (entity_status.name() == entity_string) {
-      return entity_status.pose();
-    }
-  }
-
-  throw SimulationRuntimeError(
-    configuration_.detect_all_objects_in_range()
-      ? "Filtered object is not includes in entity statuses"
-      : "Detected object by lidar sensor is not included in lidar detected entity");
-}
-
 auto DetectionSensorBase::getDetectedObjects(
   const std::vector<traffic_simulator_msgs::EntityStatus> & statuses) const
   -> std::vector<std::string>
@@ -93,18 +79,31 @@ auto DetectionSensorBase::getDetectedObjects(
 auto DetectionSensorBase::filterObjectsBySensorRange(
   const std::vector<traffic_simulator_msgs::EntityStatus> & entity_statuses,
   const std::vector<std::string> & selected_entity_strings,
-  const double detection_sensor_range) const -> std::vector<std::string>
+  const double detection_sensor_range) const -> std::unordered_set<std::string>
 {
-  std::vector<std::string> detected_objects;
+  std::unordered_set<std::string> detected_objects;
   const auto sensor_pose = getSensorPose(entity_statuses);
 
+  /// @note Index statuses once, instead of searching them for each selected entity.
+  std::unordered_map<std::string, const traffic_simulator_msgs::EntityStatus *> statuses_by_name;
+  statuses_by_name.reserve(entity_statuses.size());
+  for (const auto & entity_status : entity_statuses) {
+    statuses_by_name.emplace(entity_status.name(), &entity_status);
+  }
+
   for (const auto & selected_entity_status : selected_entity_strings) {
-    const auto selected_entity_pose = getEntityPose(entity_statuses, selected_entity_status);
+    const auto iter = statuses_by_name.find(selected_entity_status);
+    if (iter == statuses_by_name.end()) {
+      throw SimulationRuntimeError(
+        configuration_.detect_all_objects_in_range()
+          ? "Filtered object is not includes in entity statuses"
+          : "Detected object by lidar sensor is not included in lidar detected entity");
+    }
     if (
       selected_entity_status != configuration_.entity() &&
       isWithinRange(
-        selected_entity_pose.position(), sensor_pose.position(), detection_sensor_range)) {
-      detected_objects.emplace_back(selected_entity_status);
+        iter->second->pose().position(), sensor_pose.position(), detection_sensor_range)) {
+      detected_objects.emplace(selected_entity_status);
     }
   }
   return detected_objects;
@@ -151,7 +150,7 @@ auto DetectionSensor<autoware_auto_perception_msgs::msg::DetectedObjects>::updat
   if (
     current_simulation_time - previous_simulation_time_ - configuration_.update_duration() >=
     -0.002) {
-    const std::vector<std::string> detected_objects = filterObjectsBySensorRange(
+    const auto detected_objects = filterObjectsBySensorRange(
       statuses,
       configuration_.detect_all_objects_in_range() ? getDetectedObjects(statuses)
                                                    : lidar_detected_entities,
@@ -168,8 +167,7 @@ auto DetectionSensor<autoware_auto_perception_msgs::msg::DetectedObjects>::updat
 
     for (const auto & status : statuses) {
       if (
-        std::find(detected_objects.begin(), detected_objects.end(), status.name()) !=
-          detected_objects.end() and
+        detected_objects.find(status.name()) != detected_objects.end() and
         status.type().type() != traffic_simulator_msgs::EntityType_Enum::EntityType_Enum_EGO) {
         autoware_auto_perception_msgs::msg::DetectedObject object;
         switch (status.subtype().value()) {
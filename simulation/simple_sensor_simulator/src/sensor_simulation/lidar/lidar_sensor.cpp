@@ -27,7 +27,7 @@ namespace simple_sensor_simulator
 template <>
 auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
   const std::vector<traffic_simulator_msgs::EntityStatus> & entities,
-  const rclcpp::Time & current_ros_time) -> sensor_msgs::msg::PointCloud2
+  const rclcpp::Time & current_ros_time, sensor_msgs::msg::PointCloud2 & pointcloud) -> void
 {
   std::optional<geometry_msgs::msg::Pose> ego_pose;
 
@@ -47,7 +47,7 @@ auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
       pose.position.x = pose.position.x + center.x();
       pose.position.y = pose.position.y + center.y();
       pose.position.z = pose.position.z + center.z();
-      raycaster_.addPrimitive<simple_sensor_simulator::primitives::Box>(
+      raycaster_.addBox(
         entity.name(),                           //
         entity.bounding_box().dimensions().x(),  //
         entity.bounding_box().dimensions().y(),  //
@@ -61,9 +61,8 @@ auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
     for (const auto vertical_angle : configuration_.vertical_angles()) {
       vertical_angles.push_back(vertical_angle);
     }
-    const auto pointcloud = raycaster_.raycast("base_link", current_ros_time, ego_pose.value());
+    raycaster_.raycast(pointcloud, "base_link", current_ros_time, ego_pose.value());
     detected_objects_ = raycaster_.getDetectedObject();
-    return pointcloud;
   } else {
     throw simple_sensor_simulator::SimulationRuntimeError("failed to find ego vehicle");
   }
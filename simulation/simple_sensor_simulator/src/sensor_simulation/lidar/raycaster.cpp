@@ -15,38 +15,94 @@
 #include <quaternion_operation/quaternion_operation.h>
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <iostream>
+#include <numeric>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+#include <set>
 #include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace simple_sensor_simulator
 {
-Raycaster::Raycaster()
-: primitive_ptrs_(0),
-  device_(rtcNewDevice(nullptr)),
-  scene_(rtcNewScene(device_)),
-  engine_(seed_gen_())
-{
-}
+Raycaster::Raycaster() : Raycaster("") {}
 
 Raycaster::Raycaster(std::string embree_config)
-: primitive_ptrs_(0),
-  device_(rtcNewDevice(embree_config.c_str())),
+: device_(rtcNewDevice(embree_config.empty() ? nullptr : embree_config.c_str())),
   scene_(rtcNewScene(device_)),
-  engine_(seed_gen_())
+  box_scene_(rtcNewScene(device_)),
+  engine_(seed_gen_()),
+  // Run as many threads as physical cores (which is usually /2 virtual threads)
+  // In heavy loads virtual threads (hyper-threading) add little to the overall performance
+  // The calling thread takes part in raycasting, so the pool has one thread less
+  thread_pool_(std::max(std::thread::hardware_concurrency() / 2, 1u) - 1)
 {
+  /// @note Only instance transforms change between raycasts, so the top level BVH is rebuilt
+  /// quickly over the instances and the BVH of the shared box mesh is never rebuilt.
+  rtcSetSceneFlags(scene_, RTC_SCENE_FLAG_DYNAMIC);
+  rtcSetSceneBuildQuality(scene_, RTC_BUILD_QUALITY_LOW);
+  primitives::Box(1, 1, 1, geometry_msgs::msg::Pose()).addToScene(device_, box_scene_);
+  rtcCommitScene(box_scene_);
 }
 
 Raycaster::~Raycaster()
 {
+  for (const auto & [name, instance] : box_instances_) {
+    rtcReleaseGeometry(instance.geometry);
+  }
   rtcReleaseScene(scene_);
+  rtcReleaseScene(box_scene_);
   rtcReleaseDevice(device_);
 }
 
+void Raycaster::addBox(
+  const std::string & name, float depth, float width, float height,
+  const geometry_msgs::msg::Pose & pose)
+{
+  auto [iter, inserted] = box_instances_.try_emplace(name);
+  auto & instance = iter->second;
+  if (inserted) {
+    instance.geometry = rtcNewGeometry(device_, RTC_GEOMETRY_TYPE_INSTANCE);
+    rtcSetGeometryInstancedScene(instance.geometry, box_scene_);
+    // enable raycasting
+    rtcSetGeometryMask(instance.geometry, 0b11111111'11111111'11111111'11111111);
+    instance.geometry_id = rtcAttachGeometry(scene_, instance.geometry);
+    geometry_ids_.emplace(instance.geometry_id, name);
+  } else if (instance.placed) {
+    throw std::runtime_error("primitive " + name + " already exist.");
+  }
+  instance.placed = true;
+
+  /**
+   * @note Hard coded parameter, smallest edge of a box.
+   * The unit box is scaled by the transform, which must not be singular.
+   */
+  constexpr float minimum_edge_length = 1e-3;
+  const auto rotation = quaternion_operation::getRotationMatrix(pose.orientation);
+  const Eigen::Vector3d scale(
+    std::max(depth, minimum_edge_length), std::max(width, minimum_edge_length),
+    std::max(height, minimum_edge_length));
+  /// @note Column major 3x4 matrix, columns are scaled axes of the box and its position.
+  std::array<float, 12> transform;
+  for (Eigen::Index column = 0; column < 3; ++column) {
+    for (Eigen::Index row = 0; row < 3; ++row) {
+      transform[column * 3 + row] = rotation(row, column) * scale(column);
+    }
+  }
+  transform[9] = pose.position.x;
+  transform[10] = pose.position.y;
+  transform[11] = pose.position.z;
+  rtcSetGeometryTransform(
+    instance.geometry, 0, RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR, transform.data());
+  rtcCommitGeometry(instance.geometry);
+}
+
 void Raycaster::setDirection(
   const simulation_api_schema::LidarConfiguration & configuration, double horizontal_angle_start,
   double horizontal_angle_end)
@@ -59,10 +115,18 @@ void Raycaster::setDirection(
   auto quat_directions = getDirections(
     vertical_angles, horizontal_angle_start, horizontal_angle_end,
     configuration.horizontal_resolution());
-  rotation_matrices_.clear();
+  direction_x_.clear();
+  direction_y_.clear();
+  direction_z_.clear();
   for (const auto & q : quat_directions) {
-    rotation_matrices_.push_back(quaternion_operation::getRotationMatrix(q));
+    const auto rotation_mat = quaternion_operation::getRotationMatrix(q);
+    direction_x_.push_back(rotation_mat(0));
+    direction_y_.push_back(rotation_mat(1));
+    direction_z_.push_back(rotation_mat(2));
   }
+  rayhits_.resize(quat_directions.size());
+  chunk_hit_counts_.resize((quat_directions.size() + chunk_size - 1) / chunk_size);
+  chunk_detected_ids_.resize(chunk_hit_counts_.size());
 }
 
 std::vector<geometry_msgs::msg::Quaternion> Raycaster::getDirections(
@@ -98,55 +162,113 @@ std::vector<geometry_msgs::msg::Quaternion> Raycaster::getDirections(
 
 const std::vector<std::string> & Raycaster::getDetectedObject() const { return detected_objects_; }
 
-const sensor_msgs::msg::PointCloud2 Raycaster::raycast(
+sensor_msgs::msg::PointCloud2 Raycaster::raycast(
   const std::string & frame_id, const rclcpp::Time & stamp, const geometry_msgs::msg::Pose & origin,
   double max_distance, double min_distance)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud_msg;
+  raycast(pointcloud_msg, frame_id, stamp, origin, max_distance, min_distance);
+  return pointcloud_msg;
+}
+
+void Raycaster::raycast(
+  sensor_msgs::msg::PointCloud2 & pointcloud_msg, const std::string & frame_id,
+  const rclcpp::Time & stamp, const geometry_msgs::msg::Pose & origin, double max_distance,
+  double min_distance)
 {
   detected_objects_ = {};
-  pcl::PointCloud<pcl::PointXYZI>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZI>());
-  for (auto & pair : primitive_ptrs_) {
-    auto id = pair.second->addToScene(device_, scene_);
-    geometry_ids_.insert({id, pair.first});
+  for (auto iter = box_instances_.begin(); iter != box_instances_.end();) {
+    if (auto & instance = iter->second; instance.placed) {
+      instance.placed = false;
+      ++iter;
+    } else {
+      rtcDetachGeometry(scene_, instance.geometry_id);
+      rtcReleaseGeometry(instance.geometry);
+      geometry_ids_.erase(instance.geometry_id);
+      iter = box_instances_.erase(iter);
+    }
   }
+  rtcCommitScene(scene_);
 
-  // Run as many threads as physical cores (which is usually /2 virtual threads)
-  // In heavy loads virtual threads (hyper-threading) add little to the overall performance
-  // This also minimizes cost of creating a thread (roughly 10us on Intel/Linux)
-  int thread_count = std::thread::hardware_concurrency() / 2;
-  // Per thread data structures:
-  std::vector<std::thread> threads(thread_count);
-  std::vector<std::set<unsigned int>> thread_detected_ids(thread_count);
-  std::vector<pcl::PointCloud<pcl::PointXYZI>::Ptr> thread_cloud(thread_count);
+  const auto orientation_matrix = quaternion_operation::getRotationMatrix(origin.orientation);
+  const auto getChunkRange = [this](const std::size_t chunk) {
+    return std::make_pair(
+      chunk * chunk_size, std::min((chunk + 1) * chunk_size, direction_x_.size()));
+  };
+  thread_pool_.parallelFor(chunk_hit_counts_.size(), [&](const std::size_t chunk) {
+    const auto [begin, end] = getChunkRange(chunk);
+    for (auto i = begin; i < end; ++i) {
+      const auto direction =
+        orientation_matrix * Eigen::Vector3d(direction_x_[i], direction_y_[i], direction_z_[i]);
+      RTCRayHit & rayhit = rayhits_[i];
+      rayhit = {};
+      rayhit.ray.org_x = origin.position.x;
+      rayhit.ray.org_y = origin.position.y;
+      rayhit.ray.org_z = origin.position.z;
+      rayhit.ray.dir_x = direction.x();
+      rayhit.ray.dir_y = direction.y();
+      rayhit.ray.dir_z = direction.z();
+      // make raycast interact with all objects
+      rayhit.ray.mask = 0b11111111'11111111'11111111'11111111;
+      rayhit.ray.tfar = max_distance;
+      rayhit.ray.tnear = min_distance;
+      rayhit.ray.flags = false;
+      rayhit.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+      rayhit.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+    }
+    /// @note Each thread needs its own context, because Embree keeps the instance stack in it.
+    RTCIntersectContext context;
+    rtcInitIntersectContext(&context);
+    context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+    rtcIntersect1M(scene_, &context, &rayhits_[begin], end - begin, sizeof(RTCRayHit));
 
-  rtcCommitScene(scene_);
-  RTCIntersectContext context;
-  for (unsigned int i = 0; i < threads.size(); ++i) {
-    thread_cloud[i] = pcl::PointCloud<pcl::PointXYZI>::Ptr(new pcl::PointCloud<pcl::PointXYZI>());
-    threads[i] = std::thread(
-      intersect, i, thread_count, scene_, thread_cloud[i], context, origin,
-      std::ref(thread_detected_ids[i]), max_distance, min_distance, std::ref(rotation_matrices_));
-  }
-  for (unsigned int i = 0; i < threads.size(); ++i) {
-    threads[i].join();
-    (*cloud) += *(thread_cloud[i]);
-  }
-  for (auto && detected_ids_in_thread : thread_detected_ids) {
-    for (const auto & id : detected_ids_in_thread) {
-      detected_objects_.emplace_back(geometry_ids_[id]);
+    chunk_hit_counts_[chunk] = 0;
+    chunk_detected_ids_[chunk].clear();
+    for (auto i = begin; i < end; ++i) {
+      if (rayhits_[i].hit.geomID != RTC_INVALID_GEOMETRY_ID) {
+        ++chunk_hit_counts_[chunk];
+        chunk_detected_ids_[chunk].insert(rayhits_[i].hit.instID[0]);
+      }
     }
-  }
+  });
 
-  for (const auto & id : geometry_ids_) {
-    rtcDetachGeometry(scene_, id.first);
-  }
+  /// @note Points of each chunk are written from the number of points of the chunks before it.
+  std::vector<std::size_t> chunk_offsets(chunk_hit_counts_.size());
+  std::exclusive_scan(
+    chunk_hit_counts_.begin(), chunk_hit_counts_.end(), chunk_offsets.begin(), std::size_t(0));
 
-  geometry_ids_.clear();
-  primitive_ptrs_.clear();
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud_msg);
+  modifier.setPointCloud2Fields(
+    4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+    sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "intensity", 1, sensor_msgs::msg::PointField::FLOAT32);
+  modifier.resize(
+    std::accumulate(chunk_hit_counts_.begin(), chunk_hit_counts_.end(), std::size_t(0)));
+  pointcloud_msg.is_dense = true;
+
+  thread_pool_.parallelFor(chunk_hit_counts_.size(), [&](const std::size_t chunk) {
+    const auto [begin, end] = getChunkRange(chunk);
+    auto data = pointcloud_msg.data.data() + chunk_offsets[chunk] * pointcloud_msg.point_step;
+    for (auto i = begin; i < end; ++i) {
+      if (rayhits_[i].hit.geomID != RTC_INVALID_GEOMETRY_ID) {
+        const float distance = rayhits_[i].ray.tfar;
+        const float point[4] = {
+          direction_x_[i] * distance, direction_y_[i] * distance, direction_z_[i] * distance, 0};
+        std::memcpy(data, point, sizeof(point));
+        data += pointcloud_msg.point_step;
+      }
+    }
+  });
+
+  std::set<unsigned int> detected_ids;
+  for (const auto & detected_ids_in_chunk : chunk_detected_ids_) {
+    detected_ids.insert(detected_ids_in_chunk.begin(), detected_ids_in_chunk.end());
+  }
+  for (const auto & id : detected_ids) {
+    detected_objects_.emplace_back(geometry_ids_[id]);
+  }
 
-  sensor_msgs::msg::PointCloud2 pointcloud_msg;
-  pcl::toROSMsg(*cloud, pointcloud_msg);
   pointcloud_msg.header.frame_id = frame_id;
   pointcloud_msg.header.stamp = stamp;
-  return pointcloud_msg;
 }
 }  // namespace simple_sensor_simulator
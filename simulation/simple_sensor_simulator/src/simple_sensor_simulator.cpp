@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <geometry_msgs/msg/pose_stamped.hpp>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -96,6 +97,7 @@ auto ScenarioSimulator::initialize(const simulation_api_schema::InitializeReques
   pedestrians_.clear();
   misc_objects_.clear();
   entity_status_.clear();
+  entity_names_.clear();
   return res;
 }
 
@@ -113,6 +115,11 @@ auto ScenarioSimulator::updateFrame(const simulation_api_schema::UpdateFrameRequ
   builtin_interfaces::msg::Time t;
   simulation_interface::toMsg(req.current_ros_time(), t);
   current_ros_time_ = t;
+  /// @note The ego has already been updated for this frame, so its status is stamped with the time
+  /// of the frame like the sensor outputs.
+  if (ego_entity_simulation_) {
+    ego_entity_simulation_->autoware->updateOnSimulationStep(current_ros_time_);
+  }
   std::vector<traffic_simulator_msgs::EntityStatus> entity_status;
   std::transform(
     entity_status_.begin(), entity_status_.end(), std::back_inserter(entity_status),
@@ -145,16 +152,37 @@ auto ScenarioSimulator::updateEntityStatus(
     updated_status->mutable_pose()->CopyFrom(status.pose());
   };
 
+  auto updateEgoStatus = [&](const std::string & name) {
+    assert(ego_entity_simulation_ && "Ego is spawned but ego_entity_simulation_ is nullptr!");
+    ego_entity_simulation_->update(
+      current_scenario_time_ + step_time_, step_time_, req.npc_logic_started());
+    simulation_api_schema::EntityStatus ego_status;
+    simulation_interface::toProto(ego_entity_simulation_->getStatus(), ego_status);
+    entity_status_.at(name) = ego_status;
+    copyStatusToResponse(ego_status);
+  };
+
+  if (req.has_status_deltas()) {
+    /// @note Ego status is always computed here, so the status sent for ego is ignored as well.
+    for (const auto & delta : req.status_deltas().deltas()) {
+      if (const auto iter = entity_names_.find(delta.id()); iter == entity_names_.end()) {
+        THROW_SEMANTIC_ERROR("Entity with handle ", delta.id(), " does not exist");
+      } else if (not isEgo(iter->second)) {
+        simulation_interface::applyDelta(delta, entity_status_.at(iter->second));
+      }
+    }
+    for (auto & [name, status] : entity_status_) {
+      status.set_time(req.status_deltas().time());
+    }
+    for (const auto & ego : ego_vehicles_) {
+      updateEgoStatus(ego.name());
+    }
+  }
+
   for (const auto & status : req.status()) {
     try {
       if (isEgo(status.name())) {
-        assert(ego_entity_simulation_ && "Ego is spawned but ego_entity_simulation_ is nullptr!");
-        ego_entity_simulation_->update(
-          current_scenario_time_ + step_time_, step_time_, req.npc_logic_started());
-        simulation_api_schema::EntityStatus ego_status;
-        simulation_interface::toProto(ego_entity_simulation_->getStatus(), ego_status);
-        entity_status_.at(status.name()) = ego_status;
-        copyStatusToResponse(ego_status);
+        updateEgoStatus(status.name());
       } else {
         entity_status_.at(status.name()) = status;
         copyStatusToResponse(status);
@@ -171,17 +199,21 @@ auto ScenarioSimulator::updateEntityStatus(
 
 template <typename SpawnRequestType>
 auto ScenarioSimulator::insertEntitySpawnedStatus(
-  const SpawnRequestType & spawn_request, const traffic_simulator_msgs::EntityType::Enum & type,
-  const traffic_simulator_msgs::EntitySubtype::Enum & subtype) -> void
+  const SpawnRequestType & spawn_request, const traffic_simulator_msgs::EntityType::Enum & type)
+  -> void
 {
   simulation_api_schema::EntityStatus init_status;
   init_status.mutable_type()->set_type(type);
-  init_status.mutable_subtype()->set_value(subtype);
+  /// @note Status deltas do not carry the subtype, so it must be taken from the spawn request.
+  *init_status.mutable_subtype() = spawn_request.parameters().subtype();
   init_status.set_time(current_scenario_time_);
   init_status.set_name(spawn_request.parameters().name());
   init_status.mutable_action_status()->set_current_action("initializing");
   init_status.mutable_pose()->CopyFrom(spawn_request.pose());
   entity_status_.insert({spawn_request.parameters().name(), init_status});
+  if (spawn_request.id() != 0) {
+    entity_names_.emplace(spawn_request.id(), spawn_request.parameters().name());
+  }
 }
 
 auto ScenarioSimulator::spawnVehicleEntity(
@@ -208,7 +240,7 @@ auto ScenarioSimulator::spawnVehicleEntity(
   } else {
     vehicles_.emplace_back(req.parameters());
   }
-  insertEntitySpawnedStatus(req, entity_type, traffic_simulator_msgs::EntitySubtype::UNKNOWN);
+  insertEntitySpawnedStatus(req, entity_type);
   auto res = simulation_api_schema::SpawnVehicleEntityResponse();
   res.mutable_result()->set_success(true);
   res.mutable_result()->set_description("");
@@ -220,9 +252,7 @@ auto ScenarioSimulator::spawnPedestrianEntity(
   -> simulation_api_schema::SpawnPedestrianEntityResponse
 {
   pedestrians_.emplace_back(req.parameters());
-  insertEntitySpawnedStatus(
-    req, traffic_simulator_msgs::EntityType::PEDESTRIAN,
-    traffic_simulator_msgs::EntitySubtype::UNKNOWN);
+  insertEntitySpawnedStatus(req, traffic_simulator_msgs::EntityType::PEDESTRIAN);
   auto res = simulation_api_schema::SpawnPedestrianEntityResponse();
   res.mutable_result()->set_success(true);
   res.mutable_result()->set_description("");
@@ -234,9 +264,7 @@ auto ScenarioSimulator::spawnMiscObjectEntity(
   -> simulation_api_schema::SpawnMiscObjectEntityResponse
 {
   misc_objects_.emplace_back(req.parameters());
-  insertEntitySpawnedStatus(
-    req, traffic_simulator_msgs::EntityType::MISC_OBJECT,
-    traffic_simulator_msgs::EntitySubtype::UNKNOWN);
+  insertEntitySpawnedStatus(req, traffic_simulator_msgs::EntityType::MISC_OBJECT);
   auto res = simulation_api_schema::SpawnMiscObjectEntityResponse();
   res.mutable_result()->set_success(true);
   res.mutable_result()->set_description("");
@@ -265,6 +293,9 @@ auto ScenarioSimulator::despawnEntity(const simulation_api_schema::DespawnEntity
                                       remove_despawn_requested_entity_from(misc_objects_);
   if (any_entity_was_removed) {
     entity_status_.erase(req.name());
+    for (auto iter = entity_names_.begin(); iter != entity_names_.end();) {
+      iter = iter->second == req.name() ? entity_names_.erase(iter) : std::next(iter);
+    }
   }
   auto res = simulation_api_schema::DespawnEntityResponse();
   res.mutable_result()->set_success(any_entity_was_removed);
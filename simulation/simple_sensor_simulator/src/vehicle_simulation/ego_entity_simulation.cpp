@@ -35,7 +35,8 @@ static auto getParameter(const std::string & name, T value = {})
 EgoEntitySimulation::EgoEntitySimulation(
   const traffic_simulator_msgs::msg::VehicleParameters & parameters, double step_time,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils)
-: autoware(std::make_unique<concealer::AutowareUniverse>()),
+: autoware(std::make_unique<concealer::AutowareUniverse>(
+    getParameter<bool>("publish_autoware_status_on_simulation_step", false))),
   vehicle_model_type_(getVehicleModelType()),
   vehicle_model_ptr_(makeSimulationModel(vehicle_model_type_, step_time, parameters)),
   hdmap_utils_ptr_(hdmap_utils)
@@ -0,0 +1,235 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/simple_sensor_simulator.hpp>
+#include <simulation_interface/conversions.hpp>
+#include <simulation_interface/zmq_multi_client.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using DetectedObjects = autoware_auto_perception_msgs::msg::DetectedObjects;
+
+constexpr double step_time = 0.1;
+
+struct Entity
+{
+  std::string name;
+  std::uint8_t type;
+  std::uint8_t subtype;
+  double x;
+};
+
+const std::vector<Entity> entities = {
+  {"ego", traffic_simulator_msgs::msg::EntityType::EGO,
+   traffic_simulator_msgs::msg::EntitySubtype::CAR, 0.0},
+  {"car", traffic_simulator_msgs::msg::EntityType::VEHICLE,
+   traffic_simulator_msgs::msg::EntitySubtype::CAR, 10.0},
+  {"truck", traffic_simulator_msgs::msg::EntityType::VEHICLE,
+   traffic_simulator_msgs::msg::EntitySubtype::TRUCK, 20.0},
+  {"walker", traffic_simulator_msgs::msg::EntityType::PEDESTRIAN,
+   traffic_simulator_msgs::msg::EntitySubtype::PEDESTRIAN, 30.0}};
+
+auto makeBoundingBox(const std::uint8_t type) -> traffic_simulator_msgs::msg::BoundingBox
+{
+  traffic_simulator_msgs::msg::BoundingBox bounding_box;
+  const bool is_pedestrian = type == traffic_simulator_msgs::msg::EntityType::PEDESTRIAN;
+  bounding_box.dimensions.x = is_pedestrian ? 0.8 : 4.0;
+  bounding_box.dimensions.y = is_pedestrian ? 0.8 : 2.0;
+  bounding_box.dimensions.z = is_pedestrian ? 2.0 : 1.5;
+  return bounding_box;
+}
+
+auto makePose(const Entity & entity, const int step) -> geometry_msgs::msg::Pose
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = entity.x + step * 0.5;
+  pose.position.y = 1.0;
+  pose.orientation.w = 1.0;
+  return pose;
+}
+
+auto makeStatus(const Entity & entity, const int step) -> traffic_simulator_msgs::msg::EntityStatus
+{
+  traffic_simulator_msgs::msg::EntityStatus status;
+  status.name = entity.name;
+  status.type.type = entity.type;
+  status.subtype.value = entity.subtype;
+  status.time = step * step_time;
+  status.bounding_box = makeBoundingBox(entity.type);
+  status.pose = makePose(entity, step);
+  status.action_status.current_action = "moving";
+  status.action_status.twist.linear.x = 5.0;
+  return status;
+}
+
+/**
+ * @brief Run a few frames of the simulator and return the last detection result.
+ * @param send_delta If true, entity statuses are sent as deltas to the status of the last frame.
+ */
+auto runSimulator(const unsigned int port, const bool send_delta) -> DetectedObjects
+{
+  zeromq::MultiClient client(simulation_interface::protocol, "localhost", port);
+
+  simulation_api_schema::InitializeRequest initialize;
+  initialize.set_realtime_factor(1.0);
+  initialize.set_step_time(step_time);
+  initialize.set_lanelet2_map_path(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm");
+  EXPECT_TRUE(client.call(initialize).result().success());
+
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    const auto & entity = entities[i];
+    const auto id = static_cast<std::uint32_t>(send_delta ? i + 1 : 0);
+    if (entity.type == traffic_simulator_msgs::msg::EntityType::PEDESTRIAN) {
+      traffic_simulator_msgs::msg::PedestrianParameters parameters;
+      parameters.name = entity.name;
+      parameters.subtype.value = entity.subtype;
+      parameters.bounding_box = makeBoundingBox(entity.type);
+      simulation_api_schema::SpawnPedestrianEntityRequest spawn;
+      simulation_interface::toProto(parameters, *spawn.mutable_parameters());
+      simulation_interface::toProto(makePose(entity, 0), *spawn.mutable_pose());
+      spawn.set_id(id);
+      EXPECT_TRUE(client.call(spawn).result().success());
+    } else {
+      traffic_simulator_msgs::msg::VehicleParameters parameters;
+      parameters.name = entity.name;
+      parameters.subtype.value = entity.subtype;
+      parameters.bounding_box = makeBoundingBox(entity.type);
+      parameters.performance.max_speed = 30.0;
+      parameters.performance.max_acceleration = 3.0;
+      parameters.performance.max_deceleration = 5.0;
+      parameters.axles.front_axle.max_steering = 0.5;
+      parameters.axles.front_axle.position_x = 2.5;
+      parameters.axles.front_axle.track_width = 1.5;
+      parameters.axles.front_axle.wheel_diameter = 0.6;
+      parameters.axles.rear_axle = parameters.axles.front_axle;
+      parameters.axles.rear_axle.position_x = 0.0;
+      simulation_api_schema::SpawnVehicleEntityRequest spawn;
+      simulation_interface::toProto(parameters, *spawn.mutable_parameters());
+      simulation_interface::toProto(makePose(entity, 0), *spawn.mutable_pose());
+      spawn.set_is_ego(entity.type == traffic_simulator_msgs::msg::EntityType::EGO);
+      spawn.set_id(id);
+      EXPECT_TRUE(client.call(spawn).result().success());
+    }
+  }
+
+  simulation_api_schema::AttachDetectionSensorRequest attach;
+  attach.mutable_configuration()->set_entity("ego");
+  attach.mutable_configuration()->set_update_duration(step_time);
+  attach.mutable_configuration()->set_range(300.0);
+  attach.mutable_configuration()->set_architecture_type("awf/universe");
+  attach.mutable_configuration()->set_detect_all_objects_in_range(true);
+  EXPECT_TRUE(client.call(attach).result().success());
+
+  auto node = std::make_shared<rclcpp::Node>("test_entity_status_delta");
+  std::optional<DetectedObjects> detected_objects;
+  const auto subscription = node->create_subscription<DetectedObjects>(
+    "/perception/object_recognition/detection/objects", rclcpp::QoS(1),
+    [&](const DetectedObjects::SharedPtr message) { detected_objects = *message; });
+
+  std::vector<std::optional<traffic_simulator_msgs::msg::EntityStatus>> sent(entities.size());
+  for (int step = 1; step <= 3; ++step) {
+    simulation_api_schema::UpdateEntityStatusRequest update;
+    if (send_delta) {
+      update.mutable_status_deltas()->set_time(step * step_time);
+    }
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+      const auto status = makeStatus(entities[i], step);
+      if (not send_delta) {
+        simulation_interface::toProto(status, *update.add_status());
+      } else if (entities[i].type != traffic_simulator_msgs::msg::EntityType::EGO) {
+        auto & delta = *update.mutable_status_deltas()->add_deltas();
+        delta.set_id(static_cast<std::uint32_t>(i + 1));
+        if (not sent[i]) {
+          simulation_interface::toProto(status.action_status, *delta.mutable_action_status());
+          simulation_interface::toProto(status.pose, *delta.mutable_pose());
+        } else if (not simulation_interface::toProto(status, *sent[i], delta)) {
+          update.mutable_status_deltas()->mutable_deltas()->RemoveLast();
+        }
+      }
+      sent[i] = status;
+    }
+    EXPECT_TRUE(client.call(update).result().success());
+
+    simulation_api_schema::UpdateFrameRequest frame;
+    frame.set_current_simulation_time(step * step_time);
+    frame.set_current_scenario_time(step * step_time);
+    EXPECT_TRUE(client.call(frame).result().success());
+  }
+
+  for (int i = 0; i < 100 and not detected_objects; ++i) {
+    rclcpp::spin_some(node);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  client.closeConnection();
+
+  EXPECT_TRUE(detected_objects.has_value());
+  return detected_objects.value_or(DetectedObjects());
+}
+}  // namespace
+
+/**
+ * @note Objects detected from status deltas must be the same as the ones detected from full
+ * statuses, including the classification which is derived from the subtype given at spawn.
+ */
+TEST(EntityStatusDelta, DetectionMatchesFullStatus)
+{
+  rclcpp::NodeOptions full_options, delta_options;
+  full_options.parameter_overrides({{"port", 5561}});
+  delta_options.parameter_overrides({{"port", 5562}});
+  const auto full_simulator =
+    std::make_shared<simple_sensor_simulator::ScenarioSimulator>(full_options);
+  const auto delta_simulator =
+    std::make_shared<simple_sensor_simulator::ScenarioSimulator>(delta_options);
+
+  /// @note Servers of the simulators poll until shutdown, which must precede their destruction.
+  struct Shutdown
+  {
+    ~Shutdown() { rclcpp::shutdown(); }
+  } shutdown;
+
+  const auto full = runSimulator(5561, false);
+  const auto delta = runSimulator(5562, true);
+
+  ASSERT_EQ(full.objects.size(), entities.size() - 1);
+  ASSERT_EQ(delta.objects.size(), full.objects.size());
+  for (std::size_t i = 0; i < full.objects.size(); ++i) {
+    ASSERT_EQ(delta.objects[i].classification.size(), 1u);
+    EXPECT_NE(
+      delta.objects[i].classification[0].label,
+      autoware_auto_perception_msgs::msg::ObjectClassification::UNKNOWN);
+    EXPECT_EQ(delta.objects[i].classification, full.objects[i].classification);
+    EXPECT_EQ(delta.objects[i].kinematics, full.objects[i].kinematics);
+    EXPECT_EQ(delta.objects[i].shape, full.objects[i].shape);
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  return RUN_ALL_TESTS();
+}
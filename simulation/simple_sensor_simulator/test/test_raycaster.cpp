@@ -0,0 +1,384 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <embree3/rtcore.h>
+#include <gtest/gtest.h>
+#include <quaternion_operation/quaternion_operation.h>
+#include <simulation_api_schema.pb.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <geometry_msgs/msg/pose.hpp>
+#include <limits>
+#include <rclcpp/time.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+#include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
+#include <simple_sensor_simulator/sensor_simulation/primitives/box.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+using simple_sensor_simulator::Raycaster;
+
+using Point = std::array<float, 3>;
+
+struct Box
+{
+  std::string name;
+  double x;
+  double y;
+  double yaw;
+};
+
+constexpr float depth = 4.0;
+constexpr float width = 2.0;
+constexpr float height = 1.5;
+
+auto makePose(const double x, const double y, const double yaw) -> geometry_msgs::msg::Pose
+{
+  geometry_msgs::msg::Vector3 rpy;
+  rpy.z = yaw;
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = quaternion_operation::convertEulerAngleToQuaternion(rpy);
+  return pose;
+}
+
+auto makeConfiguration(
+  const double horizontal_resolution = 2 * M_PI / 720,
+  const std::vector<double> & vertical_angles = {-0.03, 0.0, 0.03})
+  -> simulation_api_schema::LidarConfiguration
+{
+  simulation_api_schema::LidarConfiguration configuration;
+  configuration.set_horizontal_resolution(horizontal_resolution);
+  for (const auto vertical_angle : vertical_angles) {
+    configuration.add_vertical_angles(vertical_angle);
+  }
+  return configuration;
+}
+
+auto place(Raycaster & raycaster, const std::vector<Box> & boxes) -> void
+{
+  for (const auto & box : boxes) {
+    raycaster.addBox(box.name, depth, width, height, makePose(box.x, box.y, box.yaw));
+  }
+}
+
+auto scan(Raycaster & raycaster) -> sensor_msgs::msg::PointCloud2
+{
+  return raycaster.raycast("base_link", rclcpp::Time(), makePose(0.0, 0.0, 0.0));
+}
+
+auto readPoints(const sensor_msgs::msg::PointCloud2 & pointcloud) -> std::vector<Point>
+{
+  std::vector<Point> points;
+  sensor_msgs::PointCloud2ConstIterator<float> x(pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> y(pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> z(pointcloud, "z");
+  for (; x != x.end(); ++x, ++y, ++z) {
+    points.push_back({*x, *y, *z});
+  }
+  return points;
+}
+
+auto sorted(std::vector<std::string> names) -> std::vector<std::string>
+{
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+auto namesOf(const std::vector<Box> & boxes) -> std::vector<std::string>
+{
+  std::vector<std::string> names;
+  for (const auto & box : boxes) {
+    names.push_back(box.name);
+  }
+  return sorted(names);
+}
+
+auto expectSamePoints(
+  const std::vector<Point> & actual, const std::vector<Point> & expected,
+  const double tolerance = 1e-4) -> void
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      EXPECT_NEAR(actual[i][axis], expected[i][axis], tolerance)
+        << "point " << i << " axis " << axis;
+    }
+  }
+}
+
+/**
+ * @brief Directions of the rays in the sensor frame, in the order the Raycaster casts them.
+ */
+auto getDirections(const simulation_api_schema::LidarConfiguration & configuration)
+  -> std::vector<Point>
+{
+  std::vector<Point> directions;
+  for (double horizontal_angle = 0; horizontal_angle <= 2 * M_PI;) {
+    horizontal_angle += configuration.horizontal_resolution();
+    for (const auto vertical_angle : configuration.vertical_angles()) {
+      geometry_msgs::msg::Vector3 rpy;
+      rpy.y = vertical_angle;
+      rpy.z = horizontal_angle;
+      const auto rotation = quaternion_operation::getRotationMatrix(
+        quaternion_operation::convertEulerAngleToQuaternion(rpy));
+      directions.push_back({
+        static_cast<float>(rotation(0)), static_cast<float>(rotation(1)),
+        static_cast<float>(rotation(2))});
+    }
+  }
+  return directions;
+}
+
+/**
+ * @brief Cast the rays one by one into a scene of box meshes, without instancing or ray streams.
+ */
+auto castSerially(
+  const std::vector<Point> & directions, const std::vector<Box> & boxes,
+  const geometry_msgs::msg::Pose & origin) -> std::vector<Point>
+{
+  RTCDevice device = rtcNewDevice(nullptr);
+  RTCScene scene = rtcNewScene(device);
+  for (const auto & box : boxes) {
+    simple_sensor_simulator::primitives::Box(depth, width, height, makePose(box.x, box.y, box.yaw))
+      .addToScene(device, scene);
+  }
+  rtcCommitScene(scene);
+
+  RTCIntersectContext context;
+  rtcInitIntersectContext(&context);
+  const auto orientation = quaternion_operation::getRotationMatrix(origin.orientation);
+  std::vector<Point> points;
+  for (const auto & [x, y, z] : directions) {
+    const auto direction = orientation * Eigen::Vector3d(x, y, z);
+    RTCRayHit rayhit = {};
+    rayhit.ray.org_x = origin.position.x;
+    rayhit.ray.org_y = origin.position.y;
+    rayhit.ray.org_z = origin.position.z;
+    rayhit.ray.dir_x = direction.x();
+    rayhit.ray.dir_y = direction.y();
+    rayhit.ray.dir_z = direction.z();
+    rayhit.ray.mask = 0b11111111'11111111'11111111'11111111;
+    rayhit.ray.tnear = 0;
+    rayhit.ray.tfar = 300;
+    rayhit.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+    rayhit.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+    rtcIntersect1(scene, &context, &rayhit);
+    if (rayhit.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
+      const float distance = rayhit.ray.tfar;
+      points.push_back({x * distance, y * distance, z * distance});
+    }
+  }
+
+  rtcReleaseScene(scene);
+  rtcReleaseDevice(device);
+  return points;
+}
+}  // namespace
+
+/**
+ * @note The scene of the Raycaster persists across scans, so every scan is compared with a scan of
+ * the same boxes by a Raycaster which has never seen any other box.
+ */
+TEST(Raycaster, persistentSceneMatchesSceneBuiltFromScratch)
+{
+  const std::vector<std::vector<Box>> frames = {
+    {{"car", 10.0, 0.0, 0.0}, {"truck", 0.0, 15.0, M_PI_2}, {"bus", -20.0, 0.0, 0.0}},
+    // move car, despawn bus
+    {{"car", 20.0, 0.0, 0.3}, {"truck", 0.0, 15.0, M_PI_2}},
+    // despawn truck, spawn bike
+    {{"car", 20.0, 0.0, 0.3}, {"bike", 0.0, -12.0, 0.0}},
+    // move car back, respawn bus
+    {{"car", 10.0, 0.0, 0.0}, {"bike", 0.0, -12.0, 0.0}, {"bus", -20.0, 0.0, 0.0}},
+    // despawn all
+    {}};
+
+  Raycaster raycaster;
+  raycaster.setDirection(makeConfiguration());
+
+  for (const auto & boxes : frames) {
+    place(raycaster, boxes);
+    const auto points = readPoints(scan(raycaster));
+    const auto detected_objects = sorted(raycaster.getDetectedObject());
+
+    Raycaster raycaster_from_scratch;
+    raycaster_from_scratch.setDirection(makeConfiguration());
+    place(raycaster_from_scratch, boxes);
+    const auto points_from_scratch = readPoints(scan(raycaster_from_scratch));
+
+    EXPECT_EQ(detected_objects, namesOf(boxes));
+    EXPECT_EQ(detected_objects, sorted(raycaster_from_scratch.getDetectedObject()));
+    expectSamePoints(points, points_from_scratch);
+  }
+}
+
+TEST(Raycaster, movedBoxIsHitAtItsNewPose)
+{
+  Raycaster raycaster;
+  raycaster.setDirection(makeConfiguration());
+
+  const auto nearestPointAhead = [&](const double x) {
+    place(raycaster, {{"car", x, 0.0, 0.0}});
+    auto nearest = std::numeric_limits<float>::max();
+    for (const auto & point : readPoints(scan(raycaster))) {
+      if (point[0] > 0 and std::abs(point[1]) < 0.1) {
+        nearest = std::min(nearest, point[0]);
+      }
+    }
+    return nearest;
+  };
+
+  EXPECT_NEAR(nearestPointAhead(10.0), 10.0 - depth / 2, 1e-3);
+  EXPECT_NEAR(nearestPointAhead(20.0), 20.0 - depth / 2, 1e-3);
+  EXPECT_NEAR(nearestPointAhead(15.0), 15.0 - depth / 2, 1e-3);
+}
+
+TEST(Raycaster, despawnedBoxIsNeverHit)
+{
+  Raycaster raycaster;
+  raycaster.setDirection(makeConfiguration());
+
+  place(raycaster, {{"blocker", 10.0, 0.0, 0.0}});
+  scan(raycaster);
+  EXPECT_EQ(raycaster.getDetectedObject(), std::vector<std::string>({"blocker"}));
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(scan(raycaster).width, 0u);
+    EXPECT_TRUE(raycaster.getDetectedObject().empty());
+  }
+
+  /// @note A box placed where the despawned one was must be detected by its own name.
+  place(raycaster, {{"other", 10.0, 0.0, 0.0}});
+  scan(raycaster);
+  EXPECT_EQ(raycaster.getDetectedObject(), std::vector<std::string>({"other"}));
+}
+
+TEST(Raycaster, placingBoxTwiceBeforeScanThrows)
+{
+  Raycaster raycaster;
+  raycaster.setDirection(makeConfiguration());
+
+  place(raycaster, {{"car", 10.0, 0.0, 0.0}});
+  EXPECT_THROW(place(raycaster, {{"car", 20.0, 0.0, 0.0}}), std::runtime_error);
+}
+
+TEST(Raycaster, chunkedStreamsMatchSerialRaycast)
+{
+  const std::vector<Box> boxes = {
+    {"car", 9.7, 0.4, 0.2},
+    {"truck", -3.1, 14.2, 1.3},
+    {"bus", -21.3, -2.6, -0.4},
+    {"bike", 2.3, -11.8, 0.9},
+    {"van", 27.9, 13.1, 2.7}};
+
+  auto origin = makePose(0.4, -0.2, 0.1);
+  origin.position.z = 0.3;
+
+  for (const auto & configuration :
+       {makeConfiguration(), makeConfiguration(2 * M_PI / 50, {-0.02, 0.01}),
+        makeConfiguration(2 * M_PI / 2000, {-0.03, -0.01, 0.01, 0.03})}) {
+    /// @note Rays are cast in chunks of 256, so the last chunk of each configuration is partial.
+    const auto directions = getDirections(configuration);
+    EXPECT_NE(directions.size() % 256, 0u);
+
+    Raycaster raycaster;
+    raycaster.setDirection(configuration);
+    place(raycaster, boxes);
+    const auto pointcloud = raycaster.raycast("base_link", rclcpp::Time(), origin);
+
+    expectSamePoints(readPoints(pointcloud), castSerially(directions, boxes, origin), 1e-3);
+  }
+}
+
+TEST(Raycaster, pointCloudIsPackedXYZI)
+{
+  Raycaster raycaster;
+  raycaster.setDirection(makeConfiguration());
+  place(raycaster, {{"car", 10.0, 0.0, 0.0}, {"truck", 0.0, 15.0, M_PI_2}});
+  const auto pointcloud = scan(raycaster);
+
+  ASSERT_GT(pointcloud.width, 0u);
+  EXPECT_EQ(pointcloud.height, 1u);
+  EXPECT_EQ(pointcloud.point_step, 4 * sizeof(float));
+  EXPECT_EQ(pointcloud.row_step, pointcloud.width * pointcloud.point_step);
+  EXPECT_EQ(pointcloud.data.size(), pointcloud.row_step);
+  EXPECT_EQ(pointcloud.header.frame_id, "base_link");
+
+  const std::vector<std::string> names = {"x", "y", "z", "intensity"};
+  ASSERT_EQ(pointcloud.fields.size(), names.size());
+  for (std::size_t i = 0; i < names.size(); ++i) {
+    EXPECT_EQ(pointcloud.fields[i].name, names[i]);
+    EXPECT_EQ(pointcloud.fields[i].offset, i * sizeof(float));
+    EXPECT_EQ(pointcloud.fields[i].datatype, sensor_msgs::msg::PointField::FLOAT32);
+    EXPECT_EQ(pointcloud.fields[i].count, 1u);
+  }
+
+  std::size_t size = 0;
+  sensor_msgs::PointCloud2ConstIterator<float> x(pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> y(pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> z(pointcloud, "z");
+  sensor_msgs::PointCloud2ConstIterator<float> intensity(pointcloud, "intensity");
+  for (; x != x.end(); ++x, ++y, ++z, ++intensity, ++size) {
+    const auto distance = std::hypot(*x, *y, *z);
+    EXPECT_GT(distance, 0.0);
+    EXPECT_LE(distance, 300.0);
+    EXPECT_EQ(*intensity, 0.0f);
+  }
+  EXPECT_EQ(size, pointcloud.width);
+}
+
+TEST(Raycaster, pointCloudBufferIsReusedWhenHitsDrop)
+{
+  const std::vector<Box> many_boxes = {
+    {"car", 10.0, 0.0, 0.0}, {"truck", 0.0, 15.0, M_PI_2}, {"bus", -20.0, 0.0, 0.0}};
+  const std::vector<Box> few_boxes = {{"car", 20.0, 0.0, 0.0}};
+
+  const auto scanFromScratch = [](const std::vector<Box> & boxes) {
+    Raycaster raycaster;
+    raycaster.setDirection(makeConfiguration());
+    place(raycaster, boxes);
+    return readPoints(scan(raycaster));
+  };
+
+  Raycaster raycaster;
+  raycaster.setDirection(makeConfiguration());
+  sensor_msgs::msg::PointCloud2 pointcloud;
+
+  place(raycaster, many_boxes);
+  raycaster.raycast(pointcloud, "base_link", rclcpp::Time(), makePose(0.0, 0.0, 0.0));
+  const auto many_hits = pointcloud.width;
+  const auto buffer = pointcloud.data.data();
+
+  place(raycaster, few_boxes);
+  raycaster.raycast(pointcloud, "base_link", rclcpp::Time(), makePose(0.0, 0.0, 0.0));
+  EXPECT_LT(pointcloud.width, many_hits);
+  EXPECT_EQ(pointcloud.row_step, pointcloud.width * pointcloud.point_step);
+  EXPECT_EQ(pointcloud.data.size(), pointcloud.row_step);
+  EXPECT_EQ(pointcloud.data.data(), buffer);
+  /// @note No point of the previous scan may be left in the reused buffer.
+  expectSamePoints(readPoints(pointcloud), scanFromScratch(few_boxes));
+
+  place(raycaster, many_boxes);
+  raycaster.raycast(pointcloud, "base_link", rclcpp::Time(), makePose(0.0, 0.0, 0.0));
+  EXPECT_EQ(pointcloud.width, many_hits);
+  EXPECT_EQ(pointcloud.data.data(), buffer);
+  expectSamePoints(readPoints(pointcloud), scanFromScratch(many_boxes));
+}
@@ -67,7 +67,8 @@ zmqpp::message toZMQ(const Proto & proto)
 template <typename Proto>
 Proto toProto(const zmqpp::message & msg)
 {
-  std::string serialized_str = msg.get(0);
+  /// @note The payload is the last part, parts before it are the envelope of ROUTER/DEALER sockets.
+  std::string serialized_str = msg.get(msg.parts() - 1);
   Proto proto;
   proto.ParseFromString(serialized_str);
   return proto;
@@ -157,6 +158,17 @@ void toMsg(
 void toMsg(
   const simulation_api_schema::EntityStatus & proto,
   traffic_simulator_msgs::msg::EntityStatus & status);
+/**
+ * @brief Fill proto with the dynamic fields of status which differ from last_status.
+ * @return true if any field differs, so the proto has something to send.
+ */
+bool toProto(
+  const traffic_simulator_msgs::msg::EntityStatus & status,
+  const traffic_simulator_msgs::msg::EntityStatus & last_status,
+  simulation_api_schema::EntityStatusDelta & proto);
+void applyDelta(
+  const simulation_api_schema::EntityStatusDelta & proto,
+  simulation_api_schema::EntityStatus & status);
 void toProto(
   const builtin_interfaces::msg::Duration & duration, builtin_interfaces::Duration & proto);
 void toMsg(
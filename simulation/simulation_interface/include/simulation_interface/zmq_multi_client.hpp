@@ -36,6 +36,15 @@ public:
     const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
     const unsigned int socket_port);
 
+  /**
+   * @brief Connect with a socket of the given context, which must be the context of the server if
+   * the protocol is INPROC.
+   */
+  explicit MultiClient(
+    const std::shared_ptr<zmqpp::context> & context,
+    const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
+    const unsigned int socket_port);
+
   ~MultiClient();
 
   void closeConnection();
@@ -82,15 +91,35 @@ public:
   auto call(const simulation_api_schema::AttachPseudoTrafficLightDetectorRequest &)
     -> simulation_api_schema::AttachPseudoTrafficLightDetectorResponse;
 
+  /**
+   * @brief Send entity status, traffic lights and simulation frame update with a single message.
+   * @return Response to the entity status update, which the simulator replies before it updates
+   * traffic lights and simulation frame. The rest of the step is not waited here, the next call
+   * waits for it and throws if it failed.
+   */
+  auto call(const simulation_api_schema::UpdateStepRequest &)
+    -> simulation_api_schema::UpdateEntityStatusResponse;
+
+  /**
+   * @brief Wait for the simulator to finish the step requested last, if any.
+   */
+  auto waitForUpdateStep() -> void;
+
   const simulation_interface::TransportProtocol protocol;
   const std::string hostname;
 
 private:
-  zmqpp::context context_;
+  auto send(const simulation_api_schema::SimulationRequest &) -> void;
+
+  auto receive() -> simulation_api_schema::SimulationResponse;
+
+  const std::shared_ptr<zmqpp::context> context_;
   const zmqpp::socket_type type_;
   zmqpp::socket socket_;
 
   bool is_running = true;
+
+  bool is_updating_step_ = false;
 };
 }  // namespace zeromq
 
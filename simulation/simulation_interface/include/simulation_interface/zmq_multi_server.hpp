@@ -18,12 +18,14 @@
 #include <simulation_api_schema.pb.h>
 
 #include <functional>
+#include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <simulation_interface/constants.hpp>
 #include <string>
 #include <thread>
 #include <tuple>
+#include <vector>
 #include <zmqpp/zmqpp.hpp>
 
 namespace zeromq
@@ -35,9 +37,24 @@ public:
   explicit MultiServer(
     const simulation_interface::TransportProtocol & protocol,
     const simulation_interface::HostName & hostname, const unsigned int socket_port, Ts &&... xs)
-  : context_(zmqpp::context()),
-    type_(zmqpp::socket_type::reply),
-    socket_(context_, type_),
+  : MultiServer(
+      std::make_shared<zmqpp::context>(), protocol, hostname, socket_port,
+      std::forward<decltype(xs)>(xs)...)
+  {
+  }
+
+  /**
+   * @brief Bind a socket of the given context, which must be shared with the clients if the
+   * protocol is INPROC.
+   */
+  template <typename... Ts>
+  explicit MultiServer(
+    const std::shared_ptr<zmqpp::context> & context,
+    const simulation_interface::TransportProtocol & protocol,
+    const simulation_interface::HostName & hostname, const unsigned int socket_port, Ts &&... xs)
+  : context_(context),
+    type_(zmqpp::socket_type::router),
+    socket_(*context_, type_),
     functions_(std::forward<decltype(xs)>(xs)...)
   {
     socket_.bind(simulation_interface::getEndPoint(protocol, hostname, socket_port));
@@ -50,8 +67,10 @@ public:
 private:
   void poll();
   void start_poll();
+  void send(
+    const std::vector<std::string> & envelope, const simulation_api_schema::SimulationResponse &);
   std::thread thread_;
-  const zmqpp::context context_;
+  const std::shared_ptr<zmqpp::context> context_;
   const zmqpp::socket_type type_;
   zmqpp::poller poller_;
   zmqpp::socket socket_;
@@ -37,12 +37,14 @@ std::string enumToString(const TransportProtocol & protocol)
   switch (protocol) {
     case TransportProtocol::TCP:
       return "tcp";
+    case TransportProtocol::INPROC:
+      return "inproc";
       /*
     case TransportProtocol::UDP:
       return "udp";              
       */
   }
-  THROW_SIMULATION_ERROR("Protocol should be TCP.");  // LCOV_EXCL_LINE
+  THROW_SIMULATION_ERROR("Protocol should be TCP or INPROC.");  // LCOV_EXCL_LINE
 }
 
 std::string enumToString(const HostName & hostname)
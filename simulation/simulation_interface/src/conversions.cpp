@@ -173,6 +173,7 @@ void toProto(
   toProto(p.bounding_box, *proto.mutable_bounding_box());
   toProto(p.axles, *proto.mutable_axles());
   toProto(p.performance, *proto.mutable_performance());
+  toProto(p.subtype, *proto.mutable_subtype());
   proto.set_name(p.name);
 }
 
@@ -183,6 +184,7 @@ void toMsg(
   toMsg(proto.axles(), p.axles);
   toMsg(proto.bounding_box(), p.bounding_box);
   toMsg(proto.performance(), p.performance);
+  toMsg(proto.subtype(), p.subtype);
   p.name = proto.name();
 }
 
@@ -191,6 +193,7 @@ void toProto(
   traffic_simulator_msgs::PedestrianParameters & proto)
 {
   toProto(p.bounding_box, *proto.mutable_bounding_box());
+  toProto(p.subtype, *proto.mutable_subtype());
   proto.set_name(p.name);
 }
 
@@ -200,6 +203,7 @@ void toMsg(
 {
   p.name = proto.name();
   toMsg(proto.bounding_box(), p.bounding_box);
+  toMsg(proto.subtype(), p.subtype);
 }
 
 void toProto(
@@ -207,6 +211,7 @@ void toProto(
   traffic_simulator_msgs::MiscObjectParameters & proto)
 {
   toProto(p.bounding_box, *proto.mutable_bounding_box());
+  toProto(p.subtype, *proto.mutable_subtype());
   proto.set_name(p.name);
 }
 
@@ -216,6 +221,7 @@ void toMsg(
 {
   p.name = proto.name();
   toMsg(proto.bounding_box(), p.bounding_box);
+  toMsg(proto.subtype(), p.subtype);
 }
 
 void toProto(
@@ -442,6 +448,35 @@ void toMsg(
   status.lanelet_pose_valid = false;
 }
 
+bool toProto(
+  const traffic_simulator_msgs::msg::EntityStatus & status,
+  const traffic_simulator_msgs::msg::EntityStatus & last_status,
+  simulation_api_schema::EntityStatusDelta & proto)
+{
+  bool changed = false;
+  if (status.action_status != last_status.action_status) {
+    toProto(status.action_status, *proto.mutable_action_status());
+    changed = true;
+  }
+  if (status.pose != last_status.pose) {
+    toProto(status.pose, *proto.mutable_pose());
+    changed = true;
+  }
+  return changed;
+}
+
+void applyDelta(
+  const simulation_api_schema::EntityStatusDelta & proto,
+  simulation_api_schema::EntityStatus & status)
+{
+  if (proto.has_action_status()) {
+    *status.mutable_action_status() = proto.action_status();
+  }
+  if (proto.has_pose()) {
+    *status.mutable_pose() = proto.pose();
+  }
+}
+
 void toProto(
   const builtin_interfaces::msg::Duration & duration, builtin_interfaces::Duration & proto)
 {
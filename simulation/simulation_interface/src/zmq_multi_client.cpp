@@ -16,16 +16,26 @@
 #include <simulation_interface/conversions.hpp>
 #include <simulation_interface/zmq_multi_client.hpp>
 #include <string>
+#include <utility>
+
 namespace zeromq
 {
 MultiClient::MultiClient(
   const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
   const unsigned int socket_port)
+: MultiClient(std::make_shared<zmqpp::context>(), protocol, hostname, socket_port)
+{
+}
+
+MultiClient::MultiClient(
+  const std::shared_ptr<zmqpp::context> & context,
+  const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
+  const unsigned int socket_port)
 : protocol(protocol),
   hostname(hostname),
-  context_(zmqpp::context()),
-  type_(zmqpp::socket_type::request),
-  socket_(context_, type_)
+  context_(context),
+  type_(zmqpp::socket_type::dealer),
+  socket_(*context_, type_)
 {
   socket_.connect(simulation_interface::getEndPoint(protocol, hostname, socket_port));
 }
@@ -42,9 +52,31 @@ MultiClient::~MultiClient() { closeConnection(); }
 
 auto MultiClient::call(const simulation_api_schema::SimulationRequest & req)
   -> simulation_api_schema::SimulationResponse
+{
+  waitForUpdateStep();
+  send(req);
+  return receive();
+}
+
+auto MultiClient::waitForUpdateStep() -> void
+{
+  if (std::exchange(is_updating_step_, false)) {
+    if (const auto response = receive().update_step(); not response.result().success()) {
+      THROW_SIMULATION_ERROR("Failed to update step : ", response.result().description());
+    }
+  }
+}
+
+auto MultiClient::send(const simulation_api_schema::SimulationRequest & req) -> void
 {
   zmqpp::message message = toZMQ(req);
+  /// @note Empty delimiter frame, which REQ sockets add implicitly.
+  message.push_front("");
   socket_.send(message);
+}
+
+auto MultiClient::receive() -> simulation_api_schema::SimulationResponse
+{
   zmqpp::message buffer;
   socket_.receive(buffer);
   return toProto<simulation_api_schema::SimulationResponse>(buffer);
@@ -206,4 +238,20 @@ auto MultiClient::call(
     return {};
   }
 }
+
+auto MultiClient::call(const simulation_api_schema::UpdateStepRequest & request)
+  -> simulation_api_schema::UpdateEntityStatusResponse
+{
+  if (is_running) {
+    waitForUpdateStep();
+    auto simulation_request = simulation_api_schema::SimulationRequest();
+    *simulation_request.mutable_update_step() = request;
+    send(simulation_request);
+    auto response = receive().update_entity_status();
+    is_updating_step_ = true;
+    return response;
+  } else {
+    return {};
+  }
+}
 }  // namespace zeromq
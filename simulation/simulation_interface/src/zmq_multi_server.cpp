@@ -15,6 +15,8 @@
 #include <simulation_interface/conversions.hpp>
 #include <simulation_interface/zmq_multi_server.hpp>
 #include <status_monitor/status_monitor.hpp>
+#include <string>
+#include <vector>
 
 namespace zeromq
 {
@@ -28,6 +30,11 @@ void MultiServer::poll()
     simulation_api_schema::SimulationResponse sim_response;
     zmqpp::message sim_request;
     socket_.receive(sim_request);
+    /// @note Parts before the payload are the envelope, which the reply must be prefixed with.
+    auto envelope = std::vector<std::string>(sim_request.parts() - 1);
+    for (std::size_t i = 0; i < envelope.size(); ++i) {
+      sim_request.get(envelope[i], i);
+    }
     auto proto = toProto<simulation_api_schema::SimulationRequest>(sim_request);
     switch (proto.request_case()) {
       case simulation_api_schema::SimulationRequest::RequestCase::kInitialize:
@@ -82,13 +89,40 @@ void MultiServer::poll()
           std::get<AttachPseudoTrafficLightDetector>(functions_)(
             proto.attach_pseudo_traffic_light_detector());
         break;
+      case simulation_api_schema::SimulationRequest::RequestCase::kUpdateStep: {
+        /// @note Reply entity status first, so that the client can go on while the frame is updated.
+        *sim_response.mutable_update_entity_status() =
+          std::get<UpdateEntityStatus>(functions_)(proto.update_step().update_entity_status());
+        send(envelope, sim_response);
+        auto & result = *sim_response.mutable_update_step()->mutable_result();
+        result.set_success(true);
+        if (proto.update_step().has_update_traffic_lights()) {
+          result = std::get<UpdateTrafficLights>(functions_)(
+                     proto.update_step().update_traffic_lights())
+                     .result();
+        }
+        if (result.success()) {
+          result = std::get<UpdateFrame>(functions_)(proto.update_step().update_frame()).result();
+        }
+        break;
+      }
       case simulation_api_schema::SimulationRequest::RequestCase::REQUEST_NOT_SET: {
         THROW_SIMULATION_ERROR("No case defined for oneof in SimulationRequest message");
       }
     }
-    auto msg = toZMQ(sim_response);
-    socket_.send(msg);
+    send(envelope, sim_response);
+  }
+}
+
+void MultiServer::send(
+  const std::vector<std::string> & envelope,
+  const simulation_api_schema::SimulationResponse & sim_response)
+{
+  auto msg = toZMQ(sim_response);
+  for (auto part = envelope.rbegin(); part != envelope.rend(); ++part) {
+    msg.push_front(*part);
   }
+  socket_.send(msg);
 }
 
 void MultiServer::start_poll()
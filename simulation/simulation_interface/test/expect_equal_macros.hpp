@@ -111,18 +111,24 @@
   EXPECT_POINT_EQ(MSG.center, PROTO.center()); \
   EXPECT_VECTOR3_EQ(MSG.dimensions, PROTO.dimensions());
 
+#define EXPECT_ENTITY_SUBTYPE_EQ(MSG, PROTO) \
+  EXPECT_EQ(static_cast<int>(MSG.value), static_cast<int>(PROTO.value()));
+
 #define EXPECT_VEHICLE_PARAMETERS_EQ(MSG, PROTO)                  \
   EXPECT_STREQ(MSG.name.c_str(), PROTO.name().c_str());           \
+  EXPECT_ENTITY_SUBTYPE_EQ(MSG.subtype, PROTO.subtype());         \
   EXPECT_BOUNDING_BOX_EQ(MSG.bounding_box, PROTO.bounding_box()); \
   EXPECT_PERFORMANCE_EQ(MSG.performance, PROTO.performance());    \
   EXPECT_AXLES_EQ(MSG.axles, PROTO.axles());
 
-#define EXPECT_PEDESTRIAN_PARAMETERS_EQ(MSG, PROTO)     \
-  EXPECT_STREQ(MSG.name.c_str(), PROTO.name().c_str()); \
+#define EXPECT_PEDESTRIAN_PARAMETERS_EQ(MSG, PROTO)           \
+  EXPECT_STREQ(MSG.name.c_str(), PROTO.name().c_str());       \
+  EXPECT_ENTITY_SUBTYPE_EQ(MSG.subtype, PROTO.subtype());     \
   EXPECT_BOUNDING_BOX_EQ(MSG.bounding_box, PROTO.bounding_box());
 
-#define EXPECT_MISC_OBJECT_PARAMETERS_EQ(MSG, PROTO)    \
-  EXPECT_STREQ(MSG.name.c_str(), PROTO.name().c_str()); \
+#define EXPECT_MISC_OBJECT_PARAMETERS_EQ(MSG, PROTO)          \
+  EXPECT_STREQ(MSG.name.c_str(), PROTO.name().c_str());       \
+  EXPECT_ENTITY_SUBTYPE_EQ(MSG.subtype, PROTO.subtype());     \
   EXPECT_BOUNDING_BOX_EQ(MSG.bounding_box, PROTO.bounding_box());
 
 #define EXPECT_ACTION_STATUS_EQ(MSG, PROTO)                                 \
@@ -194,6 +194,7 @@ TEST(Conversion, VehicleParameters)
   traffic_simulator_msgs::VehicleParameters proto;
   traffic_simulator_msgs::msg::VehicleParameters p;
   p.name = "foo";
+  p.subtype.value = traffic_simulator_msgs::msg::EntitySubtype::CAR;
   traffic_simulator_msgs::msg::BoundingBox box;
   box.center.x = 1.0;
   box.center.y = 1.23;
@@ -227,6 +228,7 @@ TEST(Conversion, PedestrianParameters)
   traffic_simulator_msgs::PedestrianParameters proto;
   traffic_simulator_msgs::msg::PedestrianParameters p;
   p.name = "foo";
+  p.subtype.value = traffic_simulator_msgs::msg::EntitySubtype::PEDESTRIAN;
   traffic_simulator_msgs::msg::BoundingBox box;
   box.center.x = 1.0;
   box.center.y = 1.23;
@@ -380,6 +382,44 @@ TEST(Conversion, SentEntityStatus)
   EXPECT_SENT_ENTITY_STATUS_EQ(status, proto);
 }
 
+TEST(Conversion, EntityStatusDelta)
+{
+  traffic_simulator_msgs::msg::EntityStatus last_status;
+  last_status.name = "test";
+  last_status.action_status.current_action = "test";
+  last_status.action_status.twist.linear.x = 1.0;
+  last_status.pose.position.x = 4.0;
+  last_status.pose.orientation.w = 1.0;
+  simulation_api_schema::EntityStatus proto;
+  simulation_interface::toProto(last_status, proto);
+
+  auto status = last_status;
+  status.time = 3.0;
+  simulation_api_schema::EntityStatusDelta unchanged;
+  EXPECT_FALSE(simulation_interface::toProto(status, last_status, unchanged));
+  EXPECT_FALSE(unchanged.has_action_status());
+  EXPECT_FALSE(unchanged.has_pose());
+
+  status.pose.position.x = 5.0;
+  simulation_api_schema::EntityStatusDelta pose_changed;
+  EXPECT_TRUE(simulation_interface::toProto(status, last_status, pose_changed));
+  EXPECT_FALSE(pose_changed.has_action_status());
+  EXPECT_POSE_EQ(status.pose, pose_changed.pose());
+  simulation_interface::applyDelta(pose_changed, proto);
+  EXPECT_ACTION_STATUS_EQ(status.action_status, proto.action_status());
+  EXPECT_POSE_EQ(status.pose, proto.pose());
+
+  last_status = status;
+  status.action_status.twist.linear.x = 2.0;
+  simulation_api_schema::EntityStatusDelta action_status_changed;
+  EXPECT_TRUE(simulation_interface::toProto(status, last_status, action_status_changed));
+  EXPECT_FALSE(action_status_changed.has_pose());
+  EXPECT_ACTION_STATUS_EQ(status.action_status, action_status_changed.action_status());
+  simulation_interface::applyDelta(action_status_changed, proto);
+  EXPECT_ACTION_STATUS_EQ(status.action_status, proto.action_status());
+  EXPECT_POSE_EQ(status.pose, proto.pose());
+}
+
 TEST(Conversion, Time)
 {
   builtin_interfaces::Time proto;
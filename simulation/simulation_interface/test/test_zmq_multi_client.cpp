@@ -0,0 +1,309 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <simulation_api_schema.pb.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <rclcpp/rclcpp.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <simulation_interface/zmq_multi_client.hpp>
+#include <simulation_interface/zmq_multi_server.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using simulation_interface::HostName;
+using simulation_interface::TransportProtocol;
+
+constexpr unsigned int port = 5555;
+
+auto makeResult(const bool success, const std::string & description = "")
+  -> simulation_api_schema::Result
+{
+  simulation_api_schema::Result result;
+  result.set_success(success);
+  result.set_description(description);
+  return result;
+}
+
+auto makeUpdateStepRequest(const std::string & name, const double time)
+  -> simulation_api_schema::UpdateStepRequest
+{
+  simulation_api_schema::UpdateStepRequest request;
+  request.mutable_update_entity_status()->add_status()->set_name(name);
+  request.mutable_update_traffic_lights();
+  request.mutable_update_frame()->set_current_simulation_time(time);
+  return request;
+}
+
+/**
+ * @brief Calls handled by the server, which runs the handlers on its polling thread.
+ */
+class CallLog
+{
+  std::mutex mutex;
+
+  std::vector<std::string> calls;
+
+public:
+  auto push(const std::string & call) -> void
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    calls.push_back(call);
+  }
+
+  auto get() -> std::vector<std::string>
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return calls;
+  }
+};
+
+auto whatOf(const std::function<void()> & thunk) -> std::string
+{
+  try {
+    thunk();
+  } catch (const common::SimulationError & error) {
+    return error.what();
+  }
+  return "";
+}
+
+/**
+ * @note The client and the server share a context, so that they talk over inproc:// without
+ * opening a port.
+ */
+class MultiClientTest : public testing::Test
+{
+protected:
+  void SetUp() override { rclcpp::init(0, nullptr); }
+
+  /// @note The server polls until shutdown, which must precede its destruction.
+  void TearDown() override
+  {
+    rclcpp::shutdown();
+    server.reset();
+  }
+
+  template <typename UpdateEntityStatus, typename UpdateTrafficLights, typename UpdateFrame>
+  auto serve(
+    UpdateEntityStatus && update_entity_status, UpdateTrafficLights && update_traffic_lights,
+    UpdateFrame && update_frame) -> void
+  {
+    // clang-format off
+    server = std::make_unique<zeromq::MultiServer>(
+      context, TransportProtocol::INPROC, HostName::LOCALHOST, port,
+      nullptr,  // Initialize
+      std::forward<decltype(update_frame)>(update_frame),
+      nullptr,  // SpawnVehicleEntity
+      nullptr,  // SpawnPedestrianEntity
+      nullptr,  // SpawnMiscObjectEntity
+      nullptr,  // DespawnEntity
+      std::forward<decltype(update_entity_status)>(update_entity_status),
+      nullptr,  // AttachLidarSensor
+      nullptr,  // AttachDetectionSensor
+      nullptr,  // AttachOccupancyGridSensor
+      std::forward<decltype(update_traffic_lights)>(update_traffic_lights),
+      nullptr,  // FollowPolylineTrajectory
+      nullptr);  // AttachPseudoTrafficLightDetector
+    // clang-format on
+  }
+
+  auto connect() const
+  {
+    return std::make_unique<zeromq::MultiClient>(
+      context, TransportProtocol::INPROC, "localhost", port);
+  }
+
+  const std::shared_ptr<zmqpp::context> context = std::make_shared<zmqpp::context>();
+
+  std::unique_ptr<zeromq::MultiServer> server;
+};
+}  // namespace
+
+TEST_F(MultiClientTest, updateStepRepliesEntityStatusBeforeFrame)
+{
+  CallLog log;
+  std::promise<void> frame_may_finish;
+  const auto frame_may_finish_future = frame_may_finish.get_future().share();
+
+  serve(
+    [&](const simulation_api_schema::UpdateEntityStatusRequest & request) {
+      log.push("update_entity_status");
+      simulation_api_schema::UpdateEntityStatusResponse response;
+      *response.mutable_result() = makeResult(true, request.status(0).name());
+      return response;
+    },
+    [&](const simulation_api_schema::UpdateTrafficLightsRequest &) {
+      log.push("update_traffic_lights");
+      simulation_api_schema::UpdateTrafficLightsResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [&](const simulation_api_schema::UpdateFrameRequest &) {
+      frame_may_finish_future.wait();
+      log.push("update_frame");
+      simulation_api_schema::UpdateFrameResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    });
+
+  const auto client = connect();
+  const auto response = client->call(makeUpdateStepRequest("ego", 0.1));
+
+  /// @note The first reply comes while the server is still updating the frame.
+  EXPECT_TRUE(response.result().success());
+  EXPECT_EQ(response.result().description(), "ego");
+  EXPECT_EQ(log.get().front(), "update_entity_status");
+  EXPECT_NE(log.get().back(), "update_frame");
+
+  frame_may_finish.set_value();
+  EXPECT_NO_THROW(client->waitForUpdateStep());
+  EXPECT_EQ(
+    log.get(), std::vector<std::string>(
+                 {"update_entity_status", "update_traffic_lights", "update_frame"}));
+}
+
+TEST_F(MultiClientTest, nextCallConsumesReplyOfUpdateStep)
+{
+  serve(
+    [](const simulation_api_schema::UpdateEntityStatusRequest &) {
+      simulation_api_schema::UpdateEntityStatusResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [](const simulation_api_schema::UpdateTrafficLightsRequest &) {
+      simulation_api_schema::UpdateTrafficLightsResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [](const simulation_api_schema::UpdateFrameRequest & request) {
+      simulation_api_schema::UpdateFrameResponse response;
+      *response.mutable_result() =
+        makeResult(true, std::to_string(request.current_simulation_time()));
+      return response;
+    });
+
+  const auto client = connect();
+  for (int step = 1; step <= 3; ++step) {
+    EXPECT_TRUE(client->call(makeUpdateStepRequest("ego", step)).result().success());
+  }
+
+  /// @note Without waiting explicitly, the reply to this request must not be mixed up with the
+  /// second reply of the last step.
+  simulation_api_schema::UpdateFrameRequest request;
+  request.set_current_simulation_time(4);
+  EXPECT_EQ(client->call(request).result().description(), std::to_string(4.0));
+}
+
+TEST_F(MultiClientTest, repliesFollowEnvelopeOfEachClient)
+{
+  serve(
+    [](const simulation_api_schema::UpdateEntityStatusRequest & request) {
+      simulation_api_schema::UpdateEntityStatusResponse response;
+      *response.mutable_result() = makeResult(true, request.status(0).name());
+      return response;
+    },
+    [](const simulation_api_schema::UpdateTrafficLightsRequest &) {
+      simulation_api_schema::UpdateTrafficLightsResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [](const simulation_api_schema::UpdateFrameRequest & request) {
+      simulation_api_schema::UpdateFrameResponse response;
+      /// @note Only the step of the second client fails.
+      *response.mutable_result() =
+        makeResult(request.current_simulation_time() < 2, "rejected step of second client");
+      return response;
+    });
+
+  const auto first_client = connect();
+  const auto second_client = connect();
+
+  EXPECT_EQ(
+    first_client->call(makeUpdateStepRequest("first", 1)).result().description(), "first");
+  EXPECT_EQ(
+    second_client->call(makeUpdateStepRequest("second", 2)).result().description(), "second");
+
+  EXPECT_NO_THROW(first_client->waitForUpdateStep());
+  EXPECT_THROW(second_client->waitForUpdateStep(), common::SimulationError);
+}
+
+TEST_F(MultiClientTest, rejectedFrameIsThrownByNextWait)
+{
+  bool reject = true;
+  serve(
+    [](const simulation_api_schema::UpdateEntityStatusRequest &) {
+      simulation_api_schema::UpdateEntityStatusResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [](const simulation_api_schema::UpdateTrafficLightsRequest &) {
+      simulation_api_schema::UpdateTrafficLightsResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [&](const simulation_api_schema::UpdateFrameRequest &) {
+      simulation_api_schema::UpdateFrameResponse response;
+      *response.mutable_result() = makeResult(not std::exchange(reject, false), "frame rejected");
+      return response;
+    });
+
+  const auto client = connect();
+  EXPECT_TRUE(client->call(makeUpdateStepRequest("ego", 1)).result().success());
+  EXPECT_NE(
+    whatOf([&]() { client->waitForUpdateStep(); }).find("frame rejected"), std::string::npos);
+
+  /// @note The failed step is not waited again, so the client goes on with the next step.
+  EXPECT_TRUE(client->call(makeUpdateStepRequest("ego", 2)).result().success());
+  EXPECT_NO_THROW(client->waitForUpdateStep());
+}
+
+TEST_F(MultiClientTest, rejectedTrafficLightsSkipFrame)
+{
+  CallLog log;
+  serve(
+    [](const simulation_api_schema::UpdateEntityStatusRequest &) {
+      simulation_api_schema::UpdateEntityStatusResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    },
+    [&](const simulation_api_schema::UpdateTrafficLightsRequest &) {
+      log.push("update_traffic_lights");
+      simulation_api_schema::UpdateTrafficLightsResponse response;
+      *response.mutable_result() = makeResult(false, "traffic lights rejected");
+      return response;
+    },
+    [&](const simulation_api_schema::UpdateFrameRequest &) {
+      log.push("update_frame");
+      simulation_api_schema::UpdateFrameResponse response;
+      *response.mutable_result() = makeResult(true);
+      return response;
+    });
+
+  const auto client = connect();
+  EXPECT_TRUE(client->call(makeUpdateStepRequest("ego", 1)).result().success());
+
+  /// @note The error of the step is thrown by the next call, which waits for the step.
+  simulation_api_schema::UpdateFrameRequest request;
+  EXPECT_NE(
+    whatOf([&]() { client->call(request); }).find("traffic lights rejected"), std::string::npos);
+  EXPECT_EQ(log.get(), std::vector<std::string>({"update_traffic_lights"}));
+}
@@ -21,6 +21,7 @@
 #include <autoware_auto_vehicle_msgs/msg/vehicle_state_command.hpp>
 #include <boost/variant.hpp>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <rclcpp/rclcpp.hpp>
@@ -30,6 +31,7 @@
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/data_type/entity_id.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/lanelet_pose.hpp>
@@ -41,7 +43,9 @@
 #include <traffic_simulator/traffic/traffic_controller.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace traffic_simulator
 {
@@ -132,6 +136,7 @@ public:
         req.mutable_parameters()->set_name(name);
         req.set_asset_key(model3d);
         simulation_interface::toProto(toMapPose(pose), *req.mutable_pose());
+        req.set_id(registerEntityHandle(name));
         req.set_is_ego(behavior == VehicleBehavior::autoware());
         /// @todo Should be filled from function API
         req.set_initial_speed(0.0);
@@ -170,6 +175,7 @@ public:
         req.mutable_parameters()->set_name(name);
         req.set_asset_key(model3d);
         simulation_interface::toProto(toMapPose(pose), *req.mutable_pose());
+        req.set_id(registerEntityHandle(name));
         return zeromq_client_.call(req).result().success();
       }
     };
@@ -196,6 +202,7 @@ public:
         req.mutable_parameters()->set_name(name);
         req.set_asset_key(model3d);
         simulation_interface::toProto(toMapPose(pose), *req.mutable_pose());
+        req.set_id(registerEntityHandle(name));
         return zeromq_client_.call(req).result().success();
       }
     };
@@ -206,6 +213,17 @@ public:
   bool despawn(const std::string & name);
   bool despawnEntities();
 
+  /**
+   * @brief Emit vehicles named name_0, name_1, ... at spawn_poses at the given rate [1/s].
+   * Vehicles reaching a traffic sink are moved back to the next spawn pose instead of being
+   * despawned, so at most max_entities vehicles are ever spawned by this source.
+   */
+  auto addTrafficSource(
+    const std::string & name, const double rate, const std::size_t max_entities,
+    const std::vector<CanonicalizedLaneletPose> & spawn_poses, const double speed,
+    const traffic_simulator_msgs::msg::VehicleParameters & parameters,
+    const std::string & behavior = VehicleBehavior::defaultBehavior()) -> void;
+
   auto setEntityStatus(const std::string & name, const CanonicalizedEntityStatus &) -> void;
   auto setEntityStatus(
     const std::string & name, const geometry_msgs::msg::Pose & map_pose,
@@ -275,8 +293,25 @@ public:
 #define FORWARD_TO_ENTITY_MANAGER(NAME)                                    \
   /*!                                                                      \
    @brief Forward to arguments to the EntityManager::NAME function.        \
-   @return return value of the EntityManager::NAME function.               \
+   @return copy of the return value of the EntityManager::NAME function.   \
    @note This function was defined by FORWARD_TO_ENTITY_MANAGER macro.     \
+   @note EntityManager returns entity state by reference, which would      \
+         dangle once the entity is despawned, so it is copied here.        \
+   */                                                                      \
+  template <typename... Ts>                                                \
+  auto NAME(Ts &&... xs)                                                   \
+  {                                                                        \
+    assert(entity_manager_ptr_);                                           \
+    return (*entity_manager_ptr_).NAME(std::forward<decltype(xs)>(xs)...); \
+  }                                                                        \
+  static_assert(true, "")
+
+#define FORWARD_REFERENCE_TO_ENTITY_MANAGER(NAME)                          \
+  /*!                                                                      \
+   @brief Forward to arguments to the EntityManager::NAME function.        \
+   @return return value of the EntityManager::NAME function as is.         \
+   @note This function was defined by FORWARD_REFERENCE_TO_ENTITY_MANAGER  \
+         macro, for functions handing out objects to be modified in place. \
    */                                                                      \
   template <typename... Ts>                                                \
   decltype(auto) NAME(Ts &&... xs)                                         \
@@ -288,7 +323,7 @@ public:
   // clang-format on
 
   FORWARD_TO_ENTITY_MANAGER(activateOutOfRangeJob);
-  FORWARD_TO_ENTITY_MANAGER(asFieldOperatorApplication);
+  FORWARD_REFERENCE_TO_ENTITY_MANAGER(asFieldOperatorApplication);
   FORWARD_TO_ENTITY_MANAGER(cancelRequest);
   FORWARD_TO_ENTITY_MANAGER(checkCollision);
   FORWARD_TO_ENTITY_MANAGER(entityExists);
@@ -298,8 +333,8 @@ public:
   FORWARD_TO_ENTITY_MANAGER(getBoundingBoxLaneLateralDistance);
   FORWARD_TO_ENTITY_MANAGER(getBoundingBoxLaneLongitudinalDistance);
   FORWARD_TO_ENTITY_MANAGER(getBoundingBoxRelativePose);
-  FORWARD_TO_ENTITY_MANAGER(getConventionalTrafficLight);
-  FORWARD_TO_ENTITY_MANAGER(getConventionalTrafficLights);
+  FORWARD_REFERENCE_TO_ENTITY_MANAGER(getConventionalTrafficLight);
+  FORWARD_REFERENCE_TO_ENTITY_MANAGER(getConventionalTrafficLights);
   FORWARD_TO_ENTITY_MANAGER(getCurrentAccel);
   FORWARD_TO_ENTITY_MANAGER(getCurrentAction);
   FORWARD_TO_ENTITY_MANAGER(getCurrentTwist);
@@ -307,6 +342,8 @@ public:
   FORWARD_TO_ENTITY_MANAGER(getDistanceToLeftLaneBound);
   FORWARD_TO_ENTITY_MANAGER(getDistanceToRightLaneBound);
   FORWARD_TO_ENTITY_MANAGER(getEgoName);
+  FORWARD_TO_ENTITY_MANAGER(getEntityId);
+  FORWARD_TO_ENTITY_MANAGER(getEntityName);
   FORWARD_TO_ENTITY_MANAGER(getEntityNames);
   FORWARD_TO_ENTITY_MANAGER(getEntityStatus);
   FORWARD_TO_ENTITY_MANAGER(getEntityStatusBeforeUpdate);
@@ -320,8 +357,8 @@ public:
   FORWARD_TO_ENTITY_MANAGER(getRelativePose);
   FORWARD_TO_ENTITY_MANAGER(getStandStillDuration);
   FORWARD_TO_ENTITY_MANAGER(getTraveledDistance);
-  FORWARD_TO_ENTITY_MANAGER(getV2ITrafficLight);
-  FORWARD_TO_ENTITY_MANAGER(getV2ITrafficLights);
+  FORWARD_REFERENCE_TO_ENTITY_MANAGER(getV2ITrafficLight);
+  FORWARD_REFERENCE_TO_ENTITY_MANAGER(getV2ITrafficLights);
   FORWARD_TO_ENTITY_MANAGER(isEgoSpawned);
   FORWARD_TO_ENTITY_MANAGER(isInLanelet);
   FORWARD_TO_ENTITY_MANAGER(isNpcLogicStarted);
@@ -344,6 +381,7 @@ public:
   FORWARD_TO_ENTITY_MANAGER(toMapPose);
 
 #undef FORWARD_TO_ENTITY_MANAGER
+#undef FORWARD_REFERENCE_TO_ENTITY_MANAGER
 
   auto canonicalize(const LaneletPose & maybe_non_canonicalized_lanelet_pose) const
     -> CanonicalizedLaneletPose;
@@ -354,6 +392,10 @@ public:
     -> std::optional<CanonicalizedLaneletPose>;
 
 private:
+  auto registerEntityHandle(const std::string & name) -> std::uint32_t;
+
+  auto makeUpdateFrameRequest() -> simulation_api_schema::UpdateFrameRequest;
+
   bool updateTimeInSim();
 
   bool updateEntitiesStatusInSim();
@@ -373,6 +415,17 @@ private:
   SimulationClock clock_;
 
   zeromq::MultiClient zeromq_client_;
+
+  /// @note Status last sent to the simulator, indexed by EntityId. The entity has a handle in the
+  /// simulator only while registered is true.
+  struct SentEntityStatus
+  {
+    bool registered = false;
+
+    std::optional<EntityStatus> status;
+  };
+
+  std::vector<SentEntityStatus> sent_entity_statuses_;
 };
 }  // namespace traffic_simulator
 
@@ -20,6 +20,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <cstddef>
 #include <iomanip>
 #include <scenario_simulator_exception/exception.hpp>
 #include <string>
@@ -44,6 +45,22 @@ struct Configuration
 
   double v2i_traffic_light_publish_rate = 10.0;
 
+  /// @note NPC behaviors are updated on this many threads. 0 and 1 mean updating them serially.
+  std::size_t npc_logic_update_threads = 1;
+
+  /**
+   * @note If true, entity status, traffic lights and time are sent to the simulator with a single
+   * UpdateStepRequest at the beginning of each frame, and NPC logic of the frame runs while the
+   * simulator updates its sensors. The simulator must support UpdateStepRequest.
+   */
+  bool pipelined_frame_update = false;
+
+  /**
+   * @note If true, entity status is sent to the simulator as EntityStatusDeltas, which contain only
+   * the changed dynamic fields of each entity. The simulator must support EntityStatusDeltas.
+   */
+  bool send_entity_status_delta = false;
+
   /* ---- NOTE -----------------------------------------------------------------
    *
    *  This setting comes from the argument of the same name (= `map_path`) in
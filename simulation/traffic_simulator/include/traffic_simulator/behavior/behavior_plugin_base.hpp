@@ -20,6 +20,7 @@
 #include <traffic_simulator/behavior/follow_trajectory.hpp>
 #include <traffic_simulator/data_type/behavior.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
@@ -33,9 +34,10 @@
 
 namespace entity_behavior
 {
-using EntityTypeDict = std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>;
-using EntityStatusDict =
-  std::unordered_map<std::string, traffic_simulator::CanonicalizedEntityStatus>;
+using EntityTypeDict =
+  std::unordered_map<traffic_simulator::EntityId, traffic_simulator_msgs::msg::EntityType>;
+using EntityStatusSnapshotPtr =
+  std::shared_ptr<const traffic_simulator::entity::EntityStatusSnapshot>;
 
 class BehaviorPluginBase
 {
@@ -64,7 +66,7 @@ public:
   DEFINE_GETTER_SETTER(HdMapUtils,           "hdmap_utils",            std::shared_ptr<hdmap_utils::HdMapUtils>)
   DEFINE_GETTER_SETTER(LaneChangeParameters, "lane_change_parameters", traffic_simulator::lane_change::Parameter)
   DEFINE_GETTER_SETTER(Obstacle,             "obstacle",               std::optional<traffic_simulator_msgs::msg::Obstacle>)
-  DEFINE_GETTER_SETTER(OtherEntityStatus,    "other_entity_status",    EntityStatusDict)
+  DEFINE_GETTER_SETTER(OtherEntityStatus,    "other_entity_status",    EntityStatusSnapshotPtr)
   DEFINE_GETTER_SETTER(PedestrianParameters, "pedestrian_parameters",  traffic_simulator_msgs::msg::PedestrianParameters)
   DEFINE_GETTER_SETTER(PolylineTrajectory,   "polyline_trajectory",    std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>)
   DEFINE_GETTER_SETTER(ReferenceTrajectory,  "reference_trajectory",   std::shared_ptr<math::geometry::CatmullRomSpline>)
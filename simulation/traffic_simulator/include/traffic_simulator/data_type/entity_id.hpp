@@ -0,0 +1,45 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_ID_HPP_
+#define TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_ID_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace traffic_simulator
+{
+/**
+ * @brief Handle of an entity.
+ * Handles are assigned in spawn order starting from 0 and are never reused, even after the entity
+ * is despawned, so a handle resolved once from the entity name stays valid for the whole scenario.
+ */
+enum class EntityId : std::uint32_t {};
+
+constexpr auto toIndex(const EntityId id) noexcept -> std::size_t
+{
+  return static_cast<std::size_t>(id);
+}
+
+/**
+ * @brief Handle of the entity in the EntityStatusDelta of the simulation interface, where 0 means
+ * that the entity has no handle.
+ */
+constexpr auto toHandle(const EntityId id) noexcept -> std::uint32_t
+{
+  return static_cast<std::uint32_t>(id) + 1;
+}
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_ID_HPP_
@@ -36,21 +36,25 @@ public:
     const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils,
     const lanelet::Ids & route_lanelets);
   explicit CanonicalizedEntityStatus(const CanonicalizedEntityStatus & obj);
-  explicit operator EntityStatus() const noexcept { return entity_status_; }
+  explicit operator const EntityStatus &() const noexcept { return entity_status_; }
   CanonicalizedEntityStatus & operator=(const CanonicalizedEntityStatus & obj)
   {
     this->entity_status_ = obj.entity_status_;
     return *this;
   }
-  auto getBoundingBox() const noexcept -> traffic_simulator_msgs::msg::BoundingBox;
+  auto getName() const noexcept -> const std::string & { return entity_status_.name; }
+  auto getBoundingBox() const noexcept -> const traffic_simulator_msgs::msg::BoundingBox &;
   auto laneMatchingSucceed() const noexcept -> bool { return entity_status_.lanelet_pose_valid; }
-  auto getMapPose() const noexcept -> geometry_msgs::msg::Pose { return entity_status_.pose; }
-  auto getLaneletPose() const -> LaneletPose;
+  auto getMapPose() const noexcept -> const geometry_msgs::msg::Pose &
+  {
+    return entity_status_.pose;
+  }
+  auto getLaneletPose() const -> const LaneletPose &;
   auto setTwist(const geometry_msgs::msg::Twist & twist) -> void;
-  auto getTwist() const noexcept -> geometry_msgs::msg::Twist;
+  auto getTwist() const noexcept -> const geometry_msgs::msg::Twist &;
   auto setLinearVelocity(double linear_velocity) -> void;
   auto setAccel(const geometry_msgs::msg::Accel & accel) -> void;
-  auto getAccel() const noexcept -> geometry_msgs::msg::Accel;
+  auto getAccel() const noexcept -> const geometry_msgs::msg::Accel &;
   auto setLinearJerk(double) -> void;
   auto getLinearJerk() const noexcept -> double;
   auto setTime(double) -> void;
@@ -15,7 +15,10 @@
 #ifndef TRAFFIC_SIMULATOR__DATA_TYPE__LANELET_POSE_HPP_
 #define TRAFFIC_SIMULATOR__DATA_TYPE__LANELET_POSE_HPP_
 
+#include <memory>
+#include <mutex>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <vector>
 
 namespace traffic_simulator
 {
@@ -23,6 +26,11 @@ using LaneletPose = traffic_simulator_msgs::msg::LaneletPose;
 
 inline namespace lanelet_pose
 {
+/**
+ * @brief Lanelet pose whose s value lies within the length of its lanelet.
+ * @note Only canonicalization runs on construction. Alternative lanelet poses and the map pose are
+ * computed on first use and shared by every copy of the object.
+ */
 class CanonicalizedLaneletPose
 {
 public:
@@ -34,8 +42,11 @@ public:
     const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils,
     const lanelet::Ids & route_lanelets);
   explicit operator LaneletPose() const noexcept { return lanelet_pose_; }
-  explicit operator geometry_msgs::msg::Pose() const noexcept { return map_pose_; }
-  bool hasAlternativeLaneletPose() const { return lanelet_poses_.size() > 1; }
+  explicit operator geometry_msgs::msg::Pose() const { return getMapPose(); }
+  bool hasAlternativeLaneletPose() const
+  {
+    return not canonical_on_construction_ and getLaneletPoses().size() > 1;
+  }
   auto getAlternativeLaneletPoseBaseOnShortestRouteFrom(
     LaneletPose from, const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils) const
     -> std::optional<LaneletPose>;
@@ -63,6 +74,17 @@ public:
 #undef DEFINE_COMPARISON_OPERATOR
 
 private:
+  struct LazyMembers
+  {
+    std::once_flag lanelet_poses_computed;
+    std::vector<LaneletPose> lanelet_poses;
+    std::once_flag map_pose_computed;
+    geometry_msgs::msg::Pose map_pose;
+  };
+  static auto isCanonical(
+    const LaneletPose &, const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils) -> bool;
+  auto getLaneletPoses() const -> const std::vector<LaneletPose> &;
+  auto getMapPose() const -> const geometry_msgs::msg::Pose &;
   auto canonicalize(
     const LaneletPose & may_non_canonicalized_lanelet_pose,
     const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils) -> LaneletPose;
@@ -70,9 +92,11 @@ private:
     const LaneletPose & may_non_canonicalized_lanelet_pose,
     const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils,
     const lanelet::Ids & route_lanelets) -> LaneletPose;
+  const LaneletPose maybe_non_canonicalized_lanelet_pose_;
+  const bool canonical_on_construction_;
   const LaneletPose lanelet_pose_;
-  const std::vector<LaneletPose> lanelet_poses_;
-  const geometry_msgs::msg::Pose map_pose_;
+  const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_;
+  const std::shared_ptr<LazyMembers> lazy_members_;
 };
 }  // namespace lanelet_pose
 
@@ -21,6 +21,11 @@
 
 namespace traffic_simulator
 {
+namespace entity
+{
+class EntityStatusSnapshot;
+}  // namespace entity
+
 namespace speed_change
 {
 enum class Transition {
@@ -61,7 +66,7 @@ struct RelativeTargetSpeed
   }
   double getAbsoluteValue(
     const CanonicalizedEntityStatus & status,
-    const std::unordered_map<std::string, CanonicalizedEntityStatus> & other_status) const;
+    const entity::EntityStatusSnapshot & other_status) const;
   std::string reference_entity_name;
   Type type;
   double value;
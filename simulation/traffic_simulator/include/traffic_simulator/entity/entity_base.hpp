@@ -27,6 +27,7 @@
 #include <traffic_simulator/data_type/entity_status.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/speed_change.hpp>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
 #include <traffic_simulator/job/job_list.hpp>
@@ -70,17 +71,17 @@ public:
    */                                                         \
   /*   */ auto get##NAME() const noexcept->TYPE { return RETURN_VARIABLE; }
 
-  DEFINE_GETTER(BoundingBox,              traffic_simulator_msgs::msg::BoundingBox,        static_cast<EntityStatus>(getStatus()).bounding_box)
-  DEFINE_GETTER(CurrentAccel,             geometry_msgs::msg::Accel,                       static_cast<EntityStatus>(getStatus()).action_status.accel)
-  DEFINE_GETTER(CurrentTwist,             geometry_msgs::msg::Twist,                       static_cast<EntityStatus>(getStatus()).action_status.twist)
-  DEFINE_GETTER(DynamicConstraints,       traffic_simulator_msgs::msg::DynamicConstraints, getBehaviorParameter().dynamic_constraints)
-  DEFINE_GETTER(EntityStatusBeforeUpdate, const CanonicalizedEntityStatus &,               status_before_update_)
-  DEFINE_GETTER(EntitySubtype,            traffic_simulator_msgs::msg::EntitySubtype,      static_cast<EntityStatus>(getStatus()).subtype)
-  DEFINE_GETTER(LinearJerk,               double,                                          static_cast<EntityStatus>(getStatus()).action_status.linear_jerk)
-  DEFINE_GETTER(MapPose,                  geometry_msgs::msg::Pose,                        static_cast<EntityStatus>(getStatus()).pose)
-  DEFINE_GETTER(StandStillDuration,       double,                                          stand_still_duration_)
-  DEFINE_GETTER(Status,                   const CanonicalizedEntityStatus &,               status_)
-  DEFINE_GETTER(TraveledDistance,         double,                                          traveled_distance_)
+  DEFINE_GETTER(BoundingBox,              const traffic_simulator_msgs::msg::BoundingBox &,   status_.getBoundingBox())
+  DEFINE_GETTER(CurrentAccel,             const geometry_msgs::msg::Accel &,                  status_.getAccel())
+  DEFINE_GETTER(CurrentTwist,             const geometry_msgs::msg::Twist &,                  status_.getTwist())
+  DEFINE_GETTER(DynamicConstraints,       traffic_simulator_msgs::msg::DynamicConstraints,    getBehaviorParameter().dynamic_constraints)
+  DEFINE_GETTER(EntityStatusBeforeUpdate, const CanonicalizedEntityStatus &,                  status_before_update_)
+  DEFINE_GETTER(EntitySubtype,            const traffic_simulator_msgs::msg::EntitySubtype &, static_cast<const EntityStatus &>(status_).subtype)
+  DEFINE_GETTER(LinearJerk,               double,                                             status_.getLinearJerk())
+  DEFINE_GETTER(MapPose,                  const geometry_msgs::msg::Pose &,                   status_.getMapPose())
+  DEFINE_GETTER(StandStillDuration,       double,                                             stand_still_duration_)
+  DEFINE_GETTER(Status,                   const CanonicalizedEntityStatus &,                  status_)
+  DEFINE_GETTER(TraveledDistance,         double,                                             traveled_distance_)
   // clang-format on
 #undef DEFINE_GETTER
 
@@ -200,9 +201,9 @@ public:
   virtual void setBehaviorParameter(const traffic_simulator_msgs::msg::BehaviorParameter &) = 0;
 
   /*   */ void setEntityTypeList(
-    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> &);
+    const std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType> &);
 
-  /*   */ void setOtherStatus(const std::unordered_map<std::string, CanonicalizedEntityStatus> &);
+  /*   */ void setOtherStatus(const std::shared_ptr<const EntityStatusSnapshot> &);
 
   virtual auto setStatus(const CanonicalizedEntityStatus &) -> void;
 
@@ -221,6 +222,13 @@ public:
 
   virtual void startNpcLogic();
 
+  /**
+   * @brief Forget the requests and the per-entity history so that the entity can be reused as a
+   * newly spawned one.
+   * @note Call it after setting the new status, which becomes the status before update as well.
+   */
+  /*   */ auto resetForReuse() -> void;
+
   /*   */ void stopAtCurrentPosition();
 
   /*   */ void updateEntityStatusTimestamp(const double current_time);
@@ -248,8 +256,8 @@ protected:
   double stand_still_duration_ = 0.0;
   double traveled_distance_ = 0.0;
 
-  std::unordered_map<std::string, CanonicalizedEntityStatus> other_status_;
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list_;
+  std::shared_ptr<const EntityStatusSnapshot> other_status_;
+  std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType> entity_type_list_;
 
   std::optional<double> target_speed_;
   traffic_simulator::job::JobList job_list_;
@@ -30,6 +30,7 @@
 #include <string>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/data_type/entity_id.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/speed_change.hpp>
 #include <traffic_simulator/entity/deleted_entity.hpp>
@@ -38,6 +39,7 @@
 #include <traffic_simulator/entity/misc_object_entity.hpp>
 #include <traffic_simulator/entity/pedestrian_entity.hpp>
 #include <traffic_simulator/entity/vehicle_entity.hpp>
+#include <traffic_simulator/helper/thread_pool.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/traffic/traffic_sink.hpp>
 #include <traffic_simulator/traffic_lights/configurable_rate_updater.hpp>
@@ -92,7 +94,10 @@ class EntityManager
 
   const rclcpp::Clock::SharedPtr clock_ptr_;
 
-  std::unordered_map<std::string, std::unique_ptr<traffic_simulator::entity::EntityBase>> entities_;
+  /// @note Indexed by EntityId. Despawned entities are kept as DeletedEntity so handles stay valid.
+  std::vector<std::unique_ptr<traffic_simulator::entity::EntityBase>> entities_;
+
+  std::unordered_map<std::string, EntityId> entity_ids_;
 
   double step_time_;
 
@@ -100,6 +105,8 @@ class EntityManager
 
   bool npc_logic_started_;
 
+  const std::unique_ptr<helper::ThreadPool> npc_logic_thread_pool_;
+
   using EntityStatusWithTrajectoryArray =
     traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray;
   const rclcpp::Publisher<EntityStatusWithTrajectoryArray>::SharedPtr entity_status_array_pub_ptr_;
@@ -121,6 +128,10 @@ class EntityManager
   const std::shared_ptr<TrafficLightPublisherBase> v2i_traffic_light_publisher_ptr_;
   ConfigurableRateUpdater v2i_traffic_light_updater_, conventional_traffic_light_updater_;
 
+  auto getEntity(const EntityId id) const -> const std::unique_ptr<EntityBase> &;
+
+  auto getEntity(const std::string & name) const -> const std::unique_ptr<EntityBase> &;
+
 public:
   template <typename Node>
   auto getOrigin(Node & node) const
@@ -165,6 +176,10 @@ public:
     clock_ptr_(node->get_clock()),
     current_time_(std::numeric_limits<double>::quiet_NaN()),
     npc_logic_started_(false),
+    npc_logic_thread_pool_(
+      configuration.npc_logic_update_threads > 1
+        ? std::make_unique<helper::ThreadPool>(configuration.npc_logic_update_threads - 1)
+        : nullptr),
     entity_status_array_pub_ptr_(rclcpp::create_publisher<EntityStatusWithTrajectoryArray>(
       node, "entity/status", EntityMarkerQoS(),
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
@@ -274,10 +289,13 @@ public:
    */                                                                            \
   template <typename... Ts>                                                      \
   decltype(auto) IDENTIFIER(const std::string & name, Ts &&... xs) __VA_ARGS__   \
-  try {                                                                          \
-    return entities_.at(name)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);    \
-  } catch (const std::out_of_range &) {                                          \
-    THROW_SEMANTIC_ERROR("entity : ", name, "does not exist");                   \
+  {                                                                              \
+    return getEntity(name)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);       \
+  }                                                                              \
+  template <typename... Ts>                                                      \
+  decltype(auto) IDENTIFIER(const EntityId id, Ts &&... xs) __VA_ARGS__          \
+  {                                                                              \
+    return getEntity(id)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);         \
   }                                                                              \
   static_assert(true, "")
   // clang-format on
@@ -312,6 +330,7 @@ public:
   FORWARD_TO_ENTITY(requestFollowTrajectory, );
   FORWARD_TO_ENTITY(requestLaneChange, );
   FORWARD_TO_ENTITY(requestWalkStraight, );
+  FORWARD_TO_ENTITY(resetForReuse, );
   FORWARD_TO_ENTITY(activateOutOfRangeJob, );
   FORWARD_TO_ENTITY(setAccelerationLimit, );
   FORWARD_TO_ENTITY(setAccelerationRateLimit, );
@@ -343,8 +362,8 @@ public:
     const bool continuous);
 
   auto updateNpcLogic(
-    const std::string & name,
-    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
+    const EntityId id,
+    const std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType> & type_list)
     -> const CanonicalizedEntityStatus &;
 
   void broadcastEntityTransform();
@@ -369,12 +388,16 @@ public:
   auto getDistanceToStopLine(const std::string & name, const lanelet::Id target_stop_line_id)
     -> std::optional<double>;
 
+  auto getEntityId(const std::string & name) const -> EntityId;
+
+  auto getEntityName(const EntityId id) const -> const std::string &;
+
   auto getEntityNames() const -> const std::vector<std::string>;
 
   auto getEntityStatus(const std::string & name) const -> CanonicalizedEntityStatus;
 
   auto getEntityTypeList() const
-    -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>;
+    -> const std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType>;
 
   // clang-format off
   auto getBoundingBoxLaneLateralDistance(const CanonicalizedLaneletPose &, const traffic_simulator_msgs::msg::BoundingBox &, const CanonicalizedLaneletPose &, const traffic_simulator_msgs::msg::BoundingBox &) const -> std::optional<double>;
@@ -410,6 +433,8 @@ public:
 
   auto getNumberOfEgo() const -> std::size_t;
 
+  auto getObstacle(const EntityId id) -> std::optional<traffic_simulator_msgs::msg::Obstacle>;
+
   auto getObstacle(const std::string & name)
     -> std::optional<traffic_simulator_msgs::msg::Obstacle>;
 
@@ -426,23 +451,26 @@ public:
 
   auto getStepTime() const noexcept -> double;
 
+  auto getWaypoints(const EntityId id) -> traffic_simulator_msgs::msg::WaypointsArray;
+
   auto getWaypoints(const std::string & name) -> traffic_simulator_msgs::msg::WaypointsArray;
 
-  template <typename T>
-  auto getGoalPoses(const std::string & name) -> std::vector<T>
+  /// @note Entity is either the name or the EntityId of the entity.
+  template <typename T, typename Entity>
+  auto getGoalPoses(const Entity & entity) -> std::vector<T>
   {
     if constexpr (std::is_same_v<std::decay_t<T>, CanonicalizedLaneletPose>) {
       if (not npc_logic_started_) {
         return {};
       } else {
-        return entities_.at(name)->getGoalPoses();
+        return getEntity(entity)->getGoalPoses();
       }
     } else {
       if (not npc_logic_started_) {
         return {};
       } else {
         std::vector<geometry_msgs::msg::Pose> poses;
-        for (const auto & lanelet_pose : getGoalPoses<CanonicalizedLaneletPose>(name)) {
+        for (const auto & lanelet_pose : getGoalPoses<CanonicalizedLaneletPose>(entity)) {
           poses.push_back(toMapPose(lanelet_pose));
         }
         return poses;
@@ -450,6 +478,8 @@ public:
     }
   }
 
+  bool isEgo(const EntityId id) const;
+
   bool isEgo(const std::string & name) const;
 
   bool isEgoSpawned() const;
@@ -489,7 +519,7 @@ public:
       if constexpr (std::is_same_v<std::decay_t<Entity>, EgoEntity>) {
         if (auto iter = std::find_if(
               std::begin(entities_), std::end(entities_),
-              [this](auto && each) { return isEgo(each.first); });
+              [this](auto && each) { return isEgo(each->name); });
             iter != std::end(entities_)) {
           THROW_SEMANTIC_ERROR("multi ego simulation does not support yet");
         } else {
@@ -533,19 +563,18 @@ public:
       return CanonicalizedEntityStatus(entity_status, hdmap_utils_ptr_);
     };
 
-    if (const auto [iter, success] = entities_.emplace(
-          name, std::make_unique<Entity>(
-                  name, makeEntityStatus(), hdmap_utils_ptr_, parameters,
-                  std::forward<decltype(xs)>(xs)...));
-        success) {
+    if (entity_ids_.find(name) != std::end(entity_ids_)) {
+      THROW_SEMANTIC_ERROR("Entity ", std::quoted(name), " is already exists.");
+    } else {
+      auto & entity = entities_.emplace_back(std::make_unique<Entity>(
+        name, makeEntityStatus(), hdmap_utils_ptr_, parameters, std::forward<decltype(xs)>(xs)...));
+      entity_ids_.emplace(name, static_cast<EntityId>(entities_.size() - 1));
       // FIXME: this ignores V2I traffic lights
-      iter->second->setTrafficLightManager(conventional_traffic_light_manager_ptr_);
+      entity->setTrafficLightManager(conventional_traffic_light_manager_ptr_);
       if (npc_logic_started_ && not isEgo(name)) {
-        iter->second->startNpcLogic();
+        entity->startNpcLogic();
       }
-      return success;
-    } else {
-      THROW_SEMANTIC_ERROR("Entity ", std::quoted(name), " is already exists.");
+      return true;
     }
   }
 
@@ -0,0 +1,108 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__ENTITY__ENTITY_STATUS_SNAPSHOT_HPP_
+#define TRAFFIC_SIMULATOR__ENTITY__ENTITY_STATUS_SNAPSHOT_HPP_
+
+#include <cstdint>
+#include <geometry_msgs/msg/point.hpp>
+#include <optional>
+#include <string>
+#include <traffic_simulator/data_type/entity_id.hpp>
+#include <traffic_simulator/data_type/entity_status.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+/**
+ * @brief Immutable statuses of all entities at one point of a frame.
+ * EntityManager builds one snapshot per update phase and shares it with every entity, so entities
+ * and behavior plugins look up their neighbors through the spatial hash and the lanelet index
+ * instead of receiving (and scanning) their own copy of the whole world.
+ * @note The snapshot contains the entity that is looking at it, so callers skip their own id.
+ */
+class EntityStatusSnapshot
+{
+public:
+  using Entry = std::pair<EntityId, CanonicalizedEntityStatus>;
+
+  using Statuses = std::vector<Entry>;
+
+  EntityStatusSnapshot() = default;
+
+  explicit EntityStatusSnapshot(Statuses &&);
+
+  /// @note Indices point into statuses_, so a snapshot is shared by pointer and never copied.
+  EntityStatusSnapshot(const EntityStatusSnapshot &) = delete;
+
+  auto operator=(const EntityStatusSnapshot &) -> EntityStatusSnapshot & = delete;
+
+  auto contains(const EntityId) const -> bool;
+
+  auto at(const EntityId) const -> const CanonicalizedEntityStatus &;
+
+  /// @note Lookup by name is for entities referred to by requests, such as lane change targets.
+  auto contains(const std::string & name) const -> bool;
+
+  auto at(const std::string & name) const -> const CanonicalizedEntityStatus &;
+
+  auto getEntityId(const std::string & name) const -> std::optional<EntityId>;
+
+  auto getStatuses() const noexcept -> const Statuses & { return statuses_; }
+
+  /**
+   * @brief Get entities matched to the lanelet.
+   */
+  auto getEntitiesOnLanelet(const lanelet::Id) const -> const std::vector<const Entry *> &;
+
+  /**
+   * @brief Get entities whose bounding box may lie within the distance from the point.
+   * @note The result is a superset; callers apply their own exact test to each entity.
+   */
+  auto getEntitiesNear(const geometry_msgs::msg::Point &, const double distance) const
+    -> std::vector<const Entry *>;
+
+private:
+  using CellKey = std::int64_t;
+
+  auto getCellKey(const std::int64_t x_index, const std::int64_t y_index) const noexcept
+    -> CellKey;
+
+  auto getCellIndex(const double coordinate) const -> std::int64_t;
+
+  /** @note Hard coded parameter, edge length of a spatial hash cell in meters. */
+  static constexpr double cell_size = 25.0;
+
+  const Statuses statuses_;
+
+  /// @note Indexed by EntityId, nullptr for ids not in this snapshot.
+  std::vector<const Entry *> entries_by_id_;
+
+  std::unordered_map<std::string, const Entry *> entries_by_name_;
+
+  std::unordered_map<CellKey, std::vector<const Entry *>> cells_;
+
+  std::unordered_map<lanelet::Id, std::vector<const Entry *>> lanelet_index_;
+
+  /// @note Largest distance from an entity origin to a corner of its bounding box.
+  double max_bounding_radius_ = 0.0;
+};
+}  // namespace entity
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__ENTITY__ENTITY_STATUS_SNAPSHOT_HPP_
@@ -17,119 +17,160 @@
 
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry_msgs/msg/point.hpp>
-#include <mutex>
+#include <memory>
 #include <optional>
 #include <scenario_simulator_exception/exception.hpp>
+#include <shared_mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace hdmap_utils
 {
+/**
+ * @brief Concurrent read-mostly cache of routes.
+ * Routes are stored behind shared handles and never overwritten once inserted, so a handle (or a
+ * reference to the route it owns) stays valid for the lifetime of the cache.
+ */
 class RouteCache
 {
 public:
-  auto exists(lanelet::Id from, lanelet::Id to)
+  auto find(lanelet::Id from, lanelet::Id to) const -> std::shared_ptr<const lanelet::Ids>
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::pair<lanelet::Id, lanelet::Id> key;
-    key.first = from;
-    key.second = to;
-    return data_.find(key) != data_.end();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (const auto iter = data_.find({from, to}); iter != data_.end()) {
+      return iter->second;
+    } else {
+      return nullptr;
+    }
   }
 
-  auto getRoute(lanelet::Id from, lanelet::Id to) -> decltype(auto)
+  auto getRoute(lanelet::Id from, lanelet::Id to) const -> const lanelet::Ids &
   {
-    if (!exists(from, to)) {
+    if (const auto route = find(from, to)) {
+      return *route;
+    } else {
       THROW_SIMULATION_ERROR(
         "route from : ", from, " to : ", to, " does not exists on route cache.");
-    } else {
-      std::lock_guard<std::mutex> lock(mutex_);
-      return data_.at({from, to});
     }
   }
 
-  auto appendData(lanelet::Id from, lanelet::Id to, const lanelet::Ids & route) -> void
+  /**
+   * @note If another thread has already appended the same route, the route appended first is kept
+   * and returned, so that handles obtained before stay identical to the cached one.
+   */
+  auto appendData(lanelet::Id from, lanelet::Id to, lanelet::Ids && route)
+    -> std::shared_ptr<const lanelet::Ids>
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_[{from, to}] = route;
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return data_
+      .try_emplace({from, to}, std::make_shared<const lanelet::Ids>(std::move(route)))
+      .first->second;
   }
 
 private:
-  std::unordered_map<std::pair<lanelet::Id, lanelet::Id>, lanelet::Ids> data_;
+  std::unordered_map<std::pair<lanelet::Id, lanelet::Id>, std::shared_ptr<const lanelet::Ids>>
+    data_;
 
-  std::mutex mutex_;
+  mutable std::shared_mutex mutex_;
 };
 
-class CenterPointsCache
+/**
+ * @brief Concurrent read-mostly cache of route lengths, used as a distance oracle.
+ * Each row holds the route length from the start of one lanelet to the start of every lanelet
+ * reachable from it within a bounded radius, so that a lanelet-to-lanelet query after the first one
+ * from the same lanelet is two hash lookups.
+ */
+class RouteLengthCache
 {
 public:
-  auto exists(lanelet::Id lanelet_id) -> bool
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return data_.find(lanelet_id) != data_.end();
-  }
+  using Row = std::unordered_map<lanelet::Id, double>;
 
-  auto getCenterPoints(lanelet::Id lanelet_id) -> decltype(auto)
+  auto find(lanelet::Id from) const -> std::shared_ptr<const Row>
   {
-    if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("center point of : ", lanelet_id, " does not exists on route cache.");
-    }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return data_.at(lanelet_id);
-  }
-
-  auto getCenterPointsSpline(lanelet::Id lanelet_id) -> decltype(auto)
-  {
-    if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("center point of : ", lanelet_id, " does not exists on route cache.");
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (const auto iter = data_.find(from); iter != data_.end()) {
+      return iter->second;
+    } else {
+      return nullptr;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return splines_[lanelet_id];
   }
 
-  auto appendData(lanelet::Id lanelet_id, const std::vector<geometry_msgs::msg::Point> & route)
+  auto appendData(lanelet::Id from, Row && row) -> std::shared_ptr<const Row>
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_[lanelet_id] = route;
-    splines_[lanelet_id] = std::make_shared<math::geometry::CatmullRomSpline>(route);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return data_.try_emplace(from, std::make_shared<const Row>(std::move(row))).first->second;
   }
 
 private:
-  std::unordered_map<lanelet::Id, std::vector<geometry_msgs::msg::Point>> data_;
-
-  std::unordered_map<lanelet::Id, std::shared_ptr<math::geometry::CatmullRomSpline>> splines_;
+  std::unordered_map<lanelet::Id, std::shared_ptr<const Row>> data_;
 
-  std::mutex mutex_;
+  mutable std::shared_mutex mutex_;
 };
 
-class LaneletLengthCache
+/**
+ * @brief Immutable table of per-lanelet geometry (length, center points and spline).
+ * The table is built once at map load and only read afterwards, so it can be queried from any
+ * number of threads without locking.
+ */
+class LaneletGeometryTable
 {
 public:
-  auto exists(lanelet::Id lanelet_id)
+  struct Geometry
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return data_.find(lanelet_id) != data_.end();
-  }
+    double length;
+
+    std::vector<geometry_msgs::msg::Point> center_points;
+
+    std::shared_ptr<math::geometry::CatmullRomSpline> spline;
+  };
 
-  auto getLength(lanelet::Id lanelet_id)
+  LaneletGeometryTable() = default;
+
+  explicit LaneletGeometryTable(std::vector<std::pair<lanelet::Id, Geometry>> && geometries)
   {
-    if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("length of : ", lanelet_id, " does not exists on route cache.");
+    indices_.reserve(geometries.size());
+    data_.reserve(geometries.size());
+    for (auto && [lanelet_id, geometry] : geometries) {
+      indices_.emplace(lanelet_id, data_.size());
+      data_.push_back(std::move(geometry));
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return data_[lanelet_id];
   }
 
-  auto appendData(lanelet::Id lanelet_id, double length)
+  auto exists(lanelet::Id lanelet_id) const -> bool
+  {
+    return indices_.find(lanelet_id) != indices_.end();
+  }
+
+  auto getCenterPoints(lanelet::Id lanelet_id) const
+    -> const std::vector<geometry_msgs::msg::Point> &
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_[lanelet_id] = length;
+    return data_[getIndex(lanelet_id)].center_points;
+  }
+
+  auto getCenterPointsSpline(lanelet::Id lanelet_id) const -> const auto &
+  {
+    return data_[getIndex(lanelet_id)].spline;
+  }
+
+  auto getLength(lanelet::Id lanelet_id) const -> double
+  {
+    return data_[getIndex(lanelet_id)].length;
   }
 
 private:
-  std::unordered_map<lanelet::Id, double> data_;
+  auto getIndex(lanelet::Id lanelet_id) const -> std::size_t
+  {
+    if (const auto iter = indices_.find(lanelet_id); iter != indices_.end()) {
+      return iter->second;
+    } else {
+      THROW_SIMULATION_ERROR("geometry of : ", lanelet_id, " does not exists on geometry table.");
+    }
+  }
+
+  std::unordered_map<lanelet::Id, std::size_t> indices_;
 
-  std::mutex mutex_;
+  std::vector<Geometry> data_;
 };
 }  // namespace hdmap_utils
 
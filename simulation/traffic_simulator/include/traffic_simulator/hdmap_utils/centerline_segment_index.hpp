@@ -0,0 +1,83 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__HDMAP_UTILS__CENTERLINE_SEGMENT_INDEX_HPP_
+#define TRAFFIC_SIMULATOR__HDMAP_UTILS__CENTERLINE_SEGMENT_INDEX_HPP_
+
+#include <lanelet2_core/Forward.h>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <geometry_msgs/msg/point.hpp>
+#include <utility>
+#include <vector>
+
+namespace hdmap_utils
+{
+/**
+ * @brief Packed R-tree over the line segments of every lanelet centerline.
+ * Built once at map load, it answers "which lanelets pass near this point, and where" without
+ * solving any spline equation, so that the exact matching only runs on the best candidates.
+ */
+class CenterlineSegmentIndex
+{
+public:
+  struct Segment
+  {
+    lanelet::Id lanelet_id;
+    bool is_crosswalk;
+    double s;  // s value of the start point along the centerline polyline
+    geometry_msgs::msg::Point start;
+    geometry_msgs::msg::Point end;
+  };
+
+  struct Match
+  {
+    lanelet::Id lanelet_id;
+    double s;         // first guess of the s value, projected onto the centerline polyline
+    double distance;  // 2D distance from the query point to the centerline polyline
+  };
+
+  CenterlineSegmentIndex() = default;
+
+  explicit CenterlineSegmentIndex(std::vector<Segment> &&);
+
+  /**
+   * @brief Get lanelets whose centerline passes within distance_threshold of the point.
+   * @return At most one match per lanelet, sorted by ascending distance.
+   */
+  auto getNearbyLanelets(
+    const geometry_msgs::msg::Point &, const double distance_threshold,
+    const bool include_crosswalk) const -> std::vector<Match>;
+
+  static auto makeSegments(
+    const lanelet::Id, const std::vector<geometry_msgs::msg::Point> & center_points,
+    const bool is_crosswalk) -> std::vector<Segment>;
+
+private:
+  using Point = boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>;
+
+  using Box = boost::geometry::model::box<Point>;
+
+  std::vector<Segment> segments_;
+
+  /// @note Constructing boost::geometry::index::rtree from a range uses the packing algorithm.
+  boost::geometry::index::rtree<std::pair<Box, std::size_t>, boost::geometry::index::rstar<16>>
+    rtree_;
+};
+}  // namespace hdmap_utils
+
+#endif  // TRAFFIC_SIMULATOR__HDMAP_UTILS__CENTERLINE_SEGMENT_INDEX_HPP_
@@ -46,6 +46,7 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/hdmap_utils/cache.hpp>
+#include <traffic_simulator/hdmap_utils/centerline_segment_index.hpp>
 #include <traffic_simulator_msgs/msg/bounding_box.hpp>
 #include <traffic_simulator_msgs/msg/entity_status.hpp>
 #include <tuple>
@@ -58,6 +59,10 @@ namespace hdmap_utils
 {
 enum class LaneletType { LANE, CROSSWALK };
 
+/**
+ * @note Const member functions may be called from several threads at once, because NPCs are
+ * updated in parallel. See "Updating NPCs in parallel" in docs/developer_guide/NPCBehavior.md.
+ */
 class HdMapUtils
 {
 public:
@@ -91,11 +96,16 @@ public:
 
   auto getCenterPoints(const lanelet::Ids &) const -> std::vector<geometry_msgs::msg::Point>;
 
-  auto getCenterPoints(const lanelet::Id) const -> std::vector<geometry_msgs::msg::Point>;
+  auto getCenterPoints(const lanelet::Id) const
+    -> const std::vector<geometry_msgs::msg::Point> &;
 
   auto getCenterPointsSpline(const lanelet::Id) const
     -> std::shared_ptr<math::geometry::CatmullRomSpline>;
 
+  /// @note Joins the cached splines of the lanelets instead of fitting their center points again.
+  auto getCenterPointsSpline(const lanelet::Ids &) const
+    -> std::shared_ptr<math::geometry::CatmullRomSpline>;
+
   auto getClosestLaneletId(
     const geometry_msgs::msg::Pose &, const double distance_thresh = 30.0,
     const bool include_crosswalk = false) const -> std::optional<lanelet::Id>;
@@ -223,7 +233,7 @@ public:
 
   auto getRightOfWayLaneletIds(const lanelet::Id) const -> lanelet::Ids;
 
-  auto getRoute(const lanelet::Id from, const lanelet::Id to) const -> lanelet::Ids;
+  auto getRoute(const lanelet::Id from, const lanelet::Id to) const -> const lanelet::Ids &;
 
   auto getSpeedLimit(const lanelet::Ids &) const -> double;
 
@@ -305,16 +315,18 @@ private:
    */
   // @{
   mutable RouteCache route_cache_;
-  mutable CenterPointsCache center_points_cache_;
-  mutable LaneletLengthCache lanelet_length_cache_;
+  mutable RouteLengthCache route_length_cache_;
   // @}
 
+  LaneletGeometryTable lanelet_geometry_table_;
+
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   lanelet::routing::RoutingGraphConstPtr vehicle_routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_vehicle_ptr_;
   lanelet::routing::RoutingGraphConstPtr pedestrian_routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_pedestrian_ptr_;
   lanelet::ConstLanelets shoulder_lanelets_;
+  CenterlineSegmentIndex centerline_segment_index_;
 
   template <typename Lanelet>
   auto getLaneletIds(const std::vector<Lanelet> & lanelets) const -> lanelet::Ids
@@ -336,6 +348,12 @@ private:
 
   auto calculateAccumulatedLengths(const lanelet::ConstLineString3d &) const -> std::vector<double>;
 
+  auto calculateCenterPoints(const lanelet::ConstLanelet &) const
+    -> std::vector<geometry_msgs::msg::Point>;
+
+  auto calculateRouteLengths(const lanelet::Id from, const double max_length) const
+    -> RouteLengthCache::Row;
+
   auto calculateSegmentDistances(const lanelet::ConstLineString3d &) const -> std::vector<double>;
 
   auto excludeSubtypeLanelets(
@@ -362,6 +380,8 @@ private:
 
   auto getPreviousRoadShoulderLanelet(const lanelet::Id) const -> lanelet::Ids;
 
+  auto getRouteLength(const lanelet::Id from, const lanelet::Id to) const -> std::optional<double>;
+
   auto getStopLinesOnPath(const lanelet::Ids &) const -> lanelet::ConstLineStrings3d;
 
   auto getTrafficLightRegElementsOnPath(const lanelet::Ids &) const
@@ -383,6 +403,10 @@ private:
   auto resamplePoints(const lanelet::ConstLineString3d &, const std::int32_t num_segments) const
     -> lanelet::BasicPoints3d;
 
+  auto toLaneletPose(
+    const geometry_msgs::msg::Pose &, const lanelet::Id, const math::geometry::CatmullRomSpline &,
+    const double s) const -> std::optional<traffic_simulator_msgs::msg::LaneletPose>;
+
   auto toPoint2d(const geometry_msgs::msg::Point &) const -> lanelet::BasicPoint2d;
 
   auto toPolygon(const lanelet::ConstLineString3d &) const
@@ -0,0 +1,86 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__HELPER__THREAD_POOL_HPP_
+#define TRAFFIC_SIMULATOR__HELPER__THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace helper
+{
+/**
+ * @brief Persistent worker threads running index-parallel loops.
+ * The calling thread takes part in every loop, so a pool of N workers runs loops on N + 1 threads.
+ */
+class ThreadPool
+{
+public:
+  explicit ThreadPool(const std::size_t number_of_workers);
+
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+
+  auto operator=(const ThreadPool &) -> ThreadPool & = delete;
+
+  /**
+   * @brief Call function(i) for every i in [0, size) and wait until all calls finish.
+   * @note If some calls throw, the exception of the call with the smallest index is rethrown after
+   * every call finished, so the error reported does not depend on thread scheduling.
+   */
+  auto parallelFor(const std::size_t size, const std::function<void(std::size_t)> & function)
+    -> void;
+
+  auto getNumberOfWorkers() const noexcept -> std::size_t { return workers_.size(); }
+
+private:
+  auto work() -> void;
+
+  auto runTasks() -> void;
+
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+
+  std::condition_variable task_started_;
+
+  std::condition_variable task_finished_;
+
+  std::size_t generation_ = 0;
+
+  std::size_t running_workers_ = 0;
+
+  bool stopped_ = false;
+
+  std::size_t size_ = 0;
+
+  const std::function<void(std::size_t)> * function_ = nullptr;
+
+  std::atomic<std::size_t> next_index_{0};
+
+  std::vector<std::exception_ptr> exceptions_;
+};
+}  // namespace helper
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__HELPER__THREAD_POOL_HPP_
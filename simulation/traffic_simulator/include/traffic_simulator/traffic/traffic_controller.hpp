@@ -30,6 +30,8 @@
 #include <string>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -49,14 +51,22 @@ public:
   void addModule(Ts &&... xs)
   {
     auto module_ptr = std::make_shared<T>(std::forward<Ts>(xs)...);
+    if constexpr (std::is_same_v<T, TrafficSource>) {
+      sources_.emplace_back(module_ptr);
+    }
     modules_.emplace_back(module_ptr);
   }
   void execute();
+  /// @note Entities emitted by a TrafficSource are handed back to it instead of being despawned.
+  void despawn(const std::string & name) const;
+  /// @note Must be called for entities despawned without going through despawn().
+  void forget(const std::string & name) const;
 
 private:
   void autoSink();
   const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_;
   std::vector<std::shared_ptr<traffic_simulator::traffic::TrafficModuleBase>> modules_;
+  std::vector<std::shared_ptr<traffic_simulator::traffic::TrafficSource>> sources_;
   const std::function<std::vector<std::string>(void)> get_entity_names_function;
   const std::function<geometry_msgs::msg::Pose(const std::string &)> get_entity_pose_function;
   const std::function<void(const std::string &)> despawn_function;
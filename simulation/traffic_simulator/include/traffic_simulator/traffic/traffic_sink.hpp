@@ -26,16 +26,24 @@
 #ifndef TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_HPP_
 #define TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_HPP_
 
+#include <cstdint>
 #include <functional>
 #include <geometry_msgs/msg/pose.hpp>
 #include <string>
 #include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <unordered_map>
 #include <vector>
 
 namespace traffic_simulator
 {
 namespace traffic
 {
+/**
+ * @brief Despawns entities that come within the radius of any of its sink positions.
+ * Sink positions are bucketed into a uniform grid whose cells are no smaller than the radius, so
+ * each frame costs one pose lookup and at most nine cell probes per entity, however many sinks
+ * there are.
+ */
 class TrafficSink : public TrafficModuleBase
 {
 public:
@@ -44,14 +52,26 @@ public:
     const std::function<std::vector<std::string>(void)> & get_entity_names_function,
     const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
     const std::function<void(std::string)> & despawn_function);
+  explicit TrafficSink(
+    double radius, const std::vector<geometry_msgs::msg::Point> & positions,
+    const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+    const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+    const std::function<void(std::string)> & despawn_function);
   const double radius;
-  const geometry_msgs::msg::Point position;
+  const std::vector<geometry_msgs::msg::Point> positions;
   void execute() override;
 
 private:
+  using CellKey = std::uint64_t;
+  auto getCellIndex(const double coordinate) const -> std::int64_t;
+  auto getCellKey(const std::int64_t x_index, const std::int64_t y_index) const noexcept
+    -> CellKey;
+  auto isInside(const geometry_msgs::msg::Point & point) const -> bool;
   const std::function<std::vector<std::string>(void)> get_entity_names_function;
   const std::function<geometry_msgs::msg::Pose(const std::string &)> get_entity_pose_function;
   const std::function<void(const std::string &)> despawn_function;
+  const double cell_size;
+  std::unordered_map<CellKey, std::vector<geometry_msgs::msg::Point>> cells_;
 };
 }  // namespace traffic
 }  // namespace traffic_simulator
@@ -0,0 +1,76 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
+#define TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <traffic_simulator/data_type/lanelet_pose.hpp>
+#include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <unordered_set>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+/**
+ * @brief Emits vehicles at the given lanelet poses, cycling through them at the given rate, until
+ * max_entities vehicles owned by this source exist.
+ * A vehicle is only emitted when the next spawn pose is free. Vehicles handed back through
+ * release() are moved to the next spawn pose instead of being despawned, if an emission is due
+ * and that pose is free, so a saturated source does not create or destroy an entity, behavior
+ * plugin or simulator handle per frame.
+ */
+class TrafficSource : public TrafficModuleBase
+{
+public:
+  explicit TrafficSource(
+    const std::string & name, double rate, std::size_t max_entities,
+    const std::vector<LaneletPose> & spawn_poses,
+    const std::function<double(void)> & get_current_time_function,
+    const std::function<bool(const LaneletPose &)> & is_spawn_pose_free_function,
+    const std::function<void(const std::string &, const LaneletPose &)> & spawn_function,
+    const std::function<void(const std::string &, const LaneletPose &)> & respawn_function);
+  const std::string name;
+  const double rate;
+  const std::size_t max_entities;
+  const std::vector<LaneletPose> spawn_poses;
+  void execute() override;
+  /// @return false if the entity was not re-emitted and should be despawned as usual.
+  auto release(const std::string & entity_name) -> bool;
+  /// @note Called for entities despawned by anything else than release(), so they are not counted.
+  void forget(const std::string & entity_name);
+  auto getEntityNames() const -> const std::unordered_set<std::string> & { return entity_names_; }
+
+private:
+  auto isEmissionDue(double current_time) const -> bool;
+  /// @note Also schedules the next emission.
+  auto nextSpawnPose() -> const LaneletPose &;
+  const std::function<double(void)> get_current_time_function;
+  const std::function<bool(const LaneletPose &)> is_spawn_pose_free_function;
+  const std::function<void(const std::string &, const LaneletPose &)> spawn_function;
+  const std::function<void(const std::string &, const LaneletPose &)> respawn_function;
+  std::unordered_set<std::string> entity_names_;
+  std::size_t spawned_count_ = 0;
+  std::size_t spawn_pose_index_ = 0;
+  std::optional<double> next_emission_time_;
+};
+}  // namespace traffic
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
@@ -18,6 +18,7 @@
 #include <iomanip>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
+#include <shared_mutex>
 #include <simulation_interface/conversions.hpp>
 #include <stdexcept>  // std::out_of_range
 #include <string>
@@ -37,6 +38,9 @@ protected:
 
   TrafficLightMap traffic_lights_;
 
+  /// @note Guards the lazy construction in getTrafficLight, which NPCs may call concurrently.
+  std::shared_mutex traffic_lights_mutex_;
+
   const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_;
 
 public:
@@ -14,6 +14,9 @@
 
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <algorithm>
+#include <geometry/bounding_box.hpp>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -22,6 +25,8 @@
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/api.hpp>
+#include <utility>
+#include <vector>
 
 namespace traffic_simulator
 {
@@ -33,6 +38,11 @@ bool API::despawn(const std::string & name)
   if (!result) {
     return false;
   }
+  traffic_controller_ptr_->forget(name);
+  if (const auto index = toIndex(entity_manager_ptr_->getEntityId(name));
+      index < sent_entity_statuses_.size()) {
+    sent_entity_statuses_[index] = SentEntityStatus();
+  }
   if (not configuration.standalone_mode) {
     simulation_api_schema::DespawnEntityRequest req;
     req.set_name(name);
@@ -48,6 +58,45 @@ bool API::despawnEntities()
     entities.begin(), entities.end(), [&](const auto & entity) { return despawn(entity); });
 }
 
+auto API::addTrafficSource(
+  const std::string & name, const double rate, const std::size_t max_entities,
+  const std::vector<CanonicalizedLaneletPose> & spawn_poses, const double speed,
+  const traffic_simulator_msgs::msg::VehicleParameters & parameters, const std::string & behavior)
+  -> void
+{
+  std::vector<LaneletPose> lanelet_poses;
+  std::transform(
+    spawn_poses.begin(), spawn_poses.end(), std::back_inserter(lanelet_poses),
+    [](const auto & spawn_pose) { return static_cast<LaneletPose>(spawn_pose); });
+  traffic_controller_ptr_->addModule<traffic::TrafficSource>(
+    name, rate, max_entities, lanelet_poses, [this]() { return getCurrentTime(); },
+    [this, parameters](const auto & lanelet_pose) {
+      const auto spawn_pose = toMapPose(lanelet_pose);
+      const auto entity_names = getEntityNames();
+      return std::all_of(entity_names.begin(), entity_names.end(), [&](const auto & entity_name) {
+        /// @note getPolygonDistance returns std::nullopt for intersecting bounding boxes.
+        return math::geometry::getPolygonDistance(
+                 spawn_pose, parameters.bounding_box, getMapPose(entity_name),
+                 getBoundingBox(entity_name))
+          .has_value();
+      });
+    },
+    [this, speed, parameters, behavior](const auto & entity_name, const auto & lanelet_pose) {
+      if (not spawn(entity_name, canonicalize(lanelet_pose), parameters, behavior)) {
+        THROW_SIMULATION_ERROR("Failed to spawn ", entity_name, " from traffic source.");
+      }
+      setLinearVelocity(entity_name, speed);
+      requestSpeedChange(entity_name, speed, true);
+    },
+    [this, speed](const auto & entity_name, const auto & lanelet_pose) {
+      /// @note The entity, its behavior plugin and its handle in the simulator are reused as is.
+      setEntityStatus(
+        entity_name, canonicalize(lanelet_pose), helper::constructActionStatus(speed));
+      entity_manager_ptr_->resetForReuse(entity_name);
+      requestSpeedChange(entity_name, speed, true);
+    });
+}
+
 auto API::setEntityStatus(const std::string & name, const CanonicalizedEntityStatus & status)
   -> void
 {
@@ -199,14 +248,29 @@ bool API::attachLidarSensor(
     lidar_sensor_delay));
 }
 
-bool API::updateTimeInSim()
+auto API::registerEntityHandle(const std::string & name) -> std::uint32_t
+{
+  const auto id = entity_manager_ptr_->getEntityId(name);
+  if (sent_entity_statuses_.size() <= toIndex(id)) {
+    sent_entity_statuses_.resize(toIndex(id) + 1);
+  }
+  sent_entity_statuses_[toIndex(id)] = SentEntityStatus{true, std::nullopt};
+  return toHandle(id);
+}
+
+auto API::makeUpdateFrameRequest() -> simulation_api_schema::UpdateFrameRequest
 {
   simulation_api_schema::UpdateFrameRequest request;
   request.set_current_simulation_time(clock_.getCurrentSimulationTime());
   request.set_current_scenario_time(getCurrentTime());
   simulation_interface::toProto(
     clock_.getCurrentRosTimeAsMsg().clock, *request.mutable_current_ros_time());
-  return zeromq_client_.call(request).result().success();
+  return request;
+}
+
+bool API::updateTimeInSim()
+{
+  return zeromq_client_.call(makeUpdateFrameRequest()).result().success();
 }
 
 bool API::updateTrafficLightsInSim()
@@ -223,13 +287,55 @@ bool API::updateEntitiesStatusInSim()
 {
   simulation_api_schema::UpdateEntityStatusRequest req;
   req.set_npc_logic_started(entity_manager_ptr_->isNpcLogicStarted());
+  if (configuration.send_entity_status_delta and not configuration.standalone_mode) {
+    req.mutable_status_deltas()->set_time(getCurrentTime());
+  }
+  /// @note Statuses sent by this request become the base of the next deltas only if the simulator
+  /// accepts the request.
+  std::vector<std::pair<std::size_t, EntityStatus>> sent_statuses;
   for (const auto & entity_name : entity_manager_ptr_->getEntityNames()) {
-    auto entity_status = entity_manager_ptr_->getEntityStatus(entity_name);
-    simulation_interface::toProto(static_cast<EntityStatus>(entity_status), *req.add_status());
+    const auto entity_status =
+      static_cast<EntityStatus>(entity_manager_ptr_->getEntityStatus(entity_name));
+    if (const auto id = entity_manager_ptr_->getEntityId(entity_name);
+        req.has_status_deltas() and toIndex(id) < sent_entity_statuses_.size() and
+        sent_entity_statuses_[toIndex(id)].registered) {
+      const auto index = toIndex(id);
+      const auto & sent = sent_entity_statuses_[index];
+      auto & delta = *req.mutable_status_deltas()->add_deltas();
+      delta.set_id(toHandle(id));
+      if (not sent.status) {
+        simulation_interface::toProto(entity_status.action_status, *delta.mutable_action_status());
+        simulation_interface::toProto(entity_status.pose, *delta.mutable_pose());
+      } else if (not simulation_interface::toProto(entity_status, *sent.status, delta)) {
+        req.mutable_status_deltas()->mutable_deltas()->RemoveLast();
+      }
+      sent_statuses.emplace_back(index, entity_status);
+    } else {
+      simulation_interface::toProto(entity_status, *req.add_status());
+    }
   }
 
-  simulation_api_schema::UpdateEntityStatusResponse res;
-  if (auto res = zeromq_client_.call(req); res.result().success()) {
+  const auto call = [&]() {
+    if (configuration.pipelined_frame_update and not configuration.standalone_mode) {
+      /// @note Clock is not updated until the end of the frame, so time sent here is the same as
+      /// the time updateTimeInSim sends at the end of the frame.
+      simulation_api_schema::UpdateStepRequest step_req;
+      *step_req.mutable_update_entity_status() = std::move(req);
+      if (entity_manager_ptr_->trafficLightsChanged()) {
+        *step_req.mutable_update_traffic_lights() =
+          entity_manager_ptr_->generateUpdateRequestForConventionalTrafficLights();
+      }
+      *step_req.mutable_update_frame() = makeUpdateFrameRequest();
+      return zeromq_client_.call(step_req);
+    } else {
+      return zeromq_client_.call(req);
+    }
+  };
+
+  if (auto res = call(); res.result().success()) {
+    for (auto & [index, entity_status] : sent_statuses) {
+      sent_entity_statuses_[index].status = std::move(entity_status);
+    }
     for (const auto & res_status : res.status()) {
       auto name = res_status.name();
       auto entity_status = static_cast<EntityStatus>(entity_manager_ptr_->getEntityStatus(name));
@@ -266,7 +372,7 @@ bool API::updateFrame()
   entity_manager_ptr_->update(getCurrentTime(), clock_.getStepTime());
   traffic_controller_ptr_->execute();
 
-  if (not configuration.standalone_mode) {
+  if (not configuration.standalone_mode and not configuration.pipelined_frame_update) {
     if (!updateTrafficLightsInSim() || !updateTimeInSim()) {
       return false;
     }
@@ -34,7 +34,7 @@ CanonicalizedEntityStatus::CanonicalizedEntityStatus(
 }
 
 CanonicalizedEntityStatus::CanonicalizedEntityStatus(const CanonicalizedEntityStatus & obj)
-: entity_status_(static_cast<EntityStatus>(obj))
+: entity_status_(obj.entity_status_)
 {
 }
 
@@ -72,12 +72,12 @@ auto CanonicalizedEntityStatus::canonicalize(
 }
 
 auto CanonicalizedEntityStatus::getBoundingBox() const noexcept
-  -> traffic_simulator_msgs::msg::BoundingBox
+  -> const traffic_simulator_msgs::msg::BoundingBox &
 {
   return entity_status_.bounding_box;
 }
 
-auto CanonicalizedEntityStatus::getLaneletPose() const -> LaneletPose
+auto CanonicalizedEntityStatus::getLaneletPose() const -> const LaneletPose &
 {
   if (!laneMatchingSucceed()) {
     THROW_SEMANTIC_ERROR("Target entity status did not matched to lanelet pose.");
@@ -90,7 +90,7 @@ auto CanonicalizedEntityStatus::setTwist(const geometry_msgs::msg::Twist & twist
   entity_status_.action_status.twist = twist;
 }
 
-auto CanonicalizedEntityStatus::getTwist() const noexcept -> geometry_msgs::msg::Twist
+auto CanonicalizedEntityStatus::getTwist() const noexcept -> const geometry_msgs::msg::Twist &
 {
   return entity_status_.action_status.twist;
 }
@@ -105,7 +105,7 @@ auto CanonicalizedEntityStatus::setAccel(const geometry_msgs::msg::Accel & accel
   entity_status_.action_status.accel = accel;
 }
 
-auto CanonicalizedEntityStatus::getAccel() const noexcept -> geometry_msgs::msg::Accel
+auto CanonicalizedEntityStatus::getAccel() const noexcept -> const geometry_msgs::msg::Accel &
 {
   return entity_status_.action_status.accel;
 }
@@ -22,23 +22,56 @@ namespace lanelet_pose
 CanonicalizedLaneletPose::CanonicalizedLaneletPose(
   const LaneletPose & maybe_non_canonicalized_lanelet_pose,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils)
-: lanelet_pose_(canonicalize(maybe_non_canonicalized_lanelet_pose, hdmap_utils)),
-  lanelet_poses_(
-    hdmap_utils->getAllCanonicalizedLaneletPoses(maybe_non_canonicalized_lanelet_pose)),
-  map_pose_(hdmap_utils->toMapPose(lanelet_pose_).pose)
+: maybe_non_canonicalized_lanelet_pose_(maybe_non_canonicalized_lanelet_pose),
+  canonical_on_construction_(isCanonical(maybe_non_canonicalized_lanelet_pose, hdmap_utils)),
+  lanelet_pose_(
+    canonical_on_construction_ ? maybe_non_canonicalized_lanelet_pose
+                               : canonicalize(maybe_non_canonicalized_lanelet_pose, hdmap_utils)),
+  hdmap_utils_(hdmap_utils),
+  lazy_members_(std::make_shared<LazyMembers>())
 {
 }
 
 CanonicalizedLaneletPose::CanonicalizedLaneletPose(
   const LaneletPose & maybe_non_canonicalized_lanelet_pose,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils, const lanelet::Ids & route_lanelets)
-: lanelet_pose_(canonicalize(maybe_non_canonicalized_lanelet_pose, hdmap_utils, route_lanelets)),
-  lanelet_poses_(
-    hdmap_utils->getAllCanonicalizedLaneletPoses(maybe_non_canonicalized_lanelet_pose)),
-  map_pose_(hdmap_utils->toMapPose(lanelet_pose_).pose)
+: maybe_non_canonicalized_lanelet_pose_(maybe_non_canonicalized_lanelet_pose),
+  canonical_on_construction_(isCanonical(maybe_non_canonicalized_lanelet_pose, hdmap_utils)),
+  lanelet_pose_(
+    canonical_on_construction_
+      ? maybe_non_canonicalized_lanelet_pose
+      : canonicalize(maybe_non_canonicalized_lanelet_pose, hdmap_utils, route_lanelets)),
+  hdmap_utils_(hdmap_utils),
+  lazy_members_(std::make_shared<LazyMembers>())
 {
 }
 
+auto CanonicalizedLaneletPose::isCanonical(
+  const LaneletPose & lanelet_pose, const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils)
+  -> bool
+{
+  return 0 <= lanelet_pose.s and
+         lanelet_pose.s <= hdmap_utils->getLaneletLength(lanelet_pose.lanelet_id);
+}
+
+auto CanonicalizedLaneletPose::getLaneletPoses() const -> const std::vector<LaneletPose> &
+{
+  /// @note std::call_once, because entity statuses are read from several threads at once.
+  std::call_once(lazy_members_->lanelet_poses_computed, [this]() {
+    lazy_members_->lanelet_poses =
+      hdmap_utils_->getAllCanonicalizedLaneletPoses(maybe_non_canonicalized_lanelet_pose_);
+  });
+  return lazy_members_->lanelet_poses;
+}
+
+auto CanonicalizedLaneletPose::getMapPose() const -> const geometry_msgs::msg::Pose &
+{
+  std::call_once(lazy_members_->map_pose_computed, [this]() {
+    lazy_members_->map_pose = hdmap_utils_->toMapPose(lanelet_pose_).pose;
+  });
+  return lazy_members_->map_pose;
+}
+
 auto CanonicalizedLaneletPose::canonicalize(
   const LaneletPose & may_non_canonicalized_lanelet_pose,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils) -> LaneletPose
@@ -84,16 +117,17 @@ auto CanonicalizedLaneletPose::getAlternativeLaneletPoseBaseOnShortestRouteFrom(
   LaneletPose from, const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils) const
   -> std::optional<LaneletPose>
 {
-  if (lanelet_poses_.empty()) {
+  const auto & lanelet_poses = getLaneletPoses();
+  if (lanelet_poses.empty()) {
     return std::nullopt;
   }
-  lanelet::Ids shortest_route =
-    hdmap_utils->getRoute(from.lanelet_id, lanelet_poses_[0].lanelet_id);
-  LaneletPose alternative_lanelet_pose = lanelet_poses_[0];
-  for (const auto & laneletPose : lanelet_poses_) {
-    const auto route = hdmap_utils->getRoute(from.lanelet_id, laneletPose.lanelet_id);
-    if (shortest_route.size() > route.size()) {
-      shortest_route = route;
+  const lanelet::Ids * shortest_route =
+    &hdmap_utils->getRoute(from.lanelet_id, lanelet_poses[0].lanelet_id);
+  LaneletPose alternative_lanelet_pose = lanelet_poses[0];
+  for (const auto & laneletPose : lanelet_poses) {
+    const auto & route = hdmap_utils->getRoute(from.lanelet_id, laneletPose.lanelet_id);
+    if (shortest_route->size() > route.size()) {
+      shortest_route = &route;
       alternative_lanelet_pose = laneletPose;
     }
   }
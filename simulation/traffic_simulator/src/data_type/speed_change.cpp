@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <traffic_simulator/data_type/speed_change.hpp>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
 
 namespace traffic_simulator
 {
@@ -32,32 +33,27 @@ static_assert(std::is_move_assignable_v<RelativeTargetSpeed>);
 
 double RelativeTargetSpeed::getAbsoluteValue(
   const CanonicalizedEntityStatus & status,
-  const std::unordered_map<std::string, CanonicalizedEntityStatus> & other_status) const
+  const entity::EntityStatusSnapshot & other_status) const
 {
-  if (const auto iter = other_status.find(reference_entity_name); iter == other_status.end()) {
-    if (static_cast<EntityStatus>(status).name == reference_entity_name) {
-      switch (type) {
-        default:
-        case Type::DELTA:
-          return status.getTwist().linear.x + value;
-        case Type::FACTOR:
-          return status.getTwist().linear.x * value;
-      }
-    } else {
-      THROW_SEMANTIC_ERROR(
-        "Reference entity name ", std::quoted(reference_entity_name),
-        " is invalid. Please check entity ", std::quoted(reference_entity_name),
-        " exists and not a same entity you want to request changing target speed.");
-    }
-
-  } else {
+  const auto get_absolute_value = [this](const CanonicalizedEntityStatus & reference_status) {
     switch (type) {
       default:
       case Type::DELTA:
-        return iter->second.getTwist().linear.x + value;
+        return reference_status.getTwist().linear.x + value;
       case Type::FACTOR:
-        return iter->second.getTwist().linear.x * value;
+        return reference_status.getTwist().linear.x * value;
     }
+  };
+  /// @note other_status may contain the entity itself, whose latest status is the one given.
+  if (status.getName() == reference_entity_name) {
+    return get_absolute_value(status);
+  } else if (other_status.contains(reference_entity_name)) {
+    return get_absolute_value(other_status.at(reference_entity_name));
+  } else {
+    THROW_SEMANTIC_ERROR(
+      "Reference entity name ", std::quoted(reference_entity_name),
+      " is invalid. Please check entity ", std::quoted(reference_entity_name),
+      " exists and not a same entity you want to request changing target speed.");
   }
 }
 }  // namespace speed_change
@@ -35,14 +35,15 @@ EntityBase::EntityBase(
   status_(entity_status),
   status_before_update_(status_),
   hdmap_utils_ptr_(hdmap_utils_ptr),
-  npc_logic_started_(false)
+  npc_logic_started_(false),
+  other_status_(std::make_shared<const EntityStatusSnapshot>())
 {
-  if (name != static_cast<EntityStatus>(entity_status).name) {
+  if (name != static_cast<const EntityStatus &>(entity_status).name) {
     THROW_SIMULATION_ERROR(
       "The name of the entity does not match the name of the entity listed in entity_status.",
       " The name of the entity is ", name,
       " and the name of the entity listed in entity_status is ",
-      static_cast<EntityStatus>(entity_status).name);
+      static_cast<const EntityStatus &>(entity_status).name);
   }
 }
 
@@ -262,7 +263,7 @@ auto EntityBase::isTargetSpeedReached(double target_speed) const -> bool
 auto EntityBase::isTargetSpeedReached(const speed_change::RelativeTargetSpeed & target_speed) const
   -> bool
 {
-  return isTargetSpeedReached(target_speed.getAbsoluteValue(getStatus(), other_status_));
+  return isTargetSpeedReached(target_speed.getAbsoluteValue(getStatus(), *other_status_));
 }
 
 void EntityBase::onUpdate(double /*current_time*/, double step_time)
@@ -307,18 +308,17 @@ void EntityBase::requestLaneChange(
     }
     reference_lanelet_id = static_cast<LaneletPose>(lanelet_pose.value()).lanelet_id;
   } else {
-    if (other_status_.find(target.entity_name) == other_status_.end()) {
+    if (target.entity_name == name or not other_status_->contains(target.entity_name)) {
       THROW_SEMANTIC_ERROR(
         "Target entity : ", target.entity_name, " does not exist. Please check ",
         target.entity_name, " exists.");
     }
-    if (!other_status_.at(target.entity_name).laneMatchingSucceed()) {
+    if (!other_status_->at(target.entity_name).laneMatchingSucceed()) {
       THROW_SEMANTIC_ERROR(
         "Target entity does not assigned to lanelet. Please check Target entity name : ",
         target.entity_name, " exists on lane.");
     }
-    reference_lanelet_id =
-      static_cast<EntityStatus>(other_status_.at(target.entity_name)).lanelet_pose.lanelet_id;
+    reference_lanelet_id = other_status_->at(target.entity_name).getLaneletPose().lanelet_id;
   }
   const auto lane_change_target_id = hdmap_utils_ptr_->getLaneChangeableLaneletId(
     reference_lanelet_id, target.direction, target.shift);
@@ -476,8 +476,8 @@ void EntityBase::requestSpeedChangeWithConstantAcceleration(
          * @brief Checking if the entity reaches target speed.
          */
         [this, target_speed, acceleration](double) {
-          double diff =
-            target_speed.getAbsoluteValue(getStatus(), other_status_) - getCurrentTwist().linear.x;
+          double diff = target_speed.getAbsoluteValue(getStatus(), *other_status_) -
+                        getCurrentTwist().linear.x;
           /**
            * @brief Hard coded parameter, threshold for difference
            */
@@ -504,7 +504,7 @@ void EntityBase::requestSpeedChangeWithConstantAcceleration(
     }
     case speed_change::Transition::STEP: {
       requestSpeedChange(target_speed, continuous);
-      setLinearVelocity(target_speed.getAbsoluteValue(getStatus(), other_status_));
+      setLinearVelocity(target_speed.getAbsoluteValue(getStatus(), *other_status_));
       break;
     }
   }
@@ -527,17 +527,19 @@ void EntityBase::requestSpeedChangeWithTimeConstraint(
   switch (transition) {
     case speed_change::Transition::LINEAR: {
       requestSpeedChangeWithTimeConstraint(
-        target_speed.getAbsoluteValue(getStatus(), other_status_), transition, acceleration_time);
+        target_speed.getAbsoluteValue(getStatus(), *other_status_), transition,
+        acceleration_time);
       break;
     }
     case speed_change::Transition::AUTO: {
       requestSpeedChangeWithTimeConstraint(
-        target_speed.getAbsoluteValue(getStatus(), other_status_), transition, acceleration_time);
+        target_speed.getAbsoluteValue(getStatus(), *other_status_), transition,
+        acceleration_time);
       break;
     }
     case speed_change::Transition::STEP: {
       requestSpeedChange(target_speed, false);
-      setLinearVelocity(target_speed.getAbsoluteValue(getStatus(), other_status_));
+      setLinearVelocity(target_speed.getAbsoluteValue(getStatus(), *other_status_));
       break;
     }
   }
@@ -619,10 +621,12 @@ void EntityBase::requestSpeedChange(
        * @brief If the target entity reaches the target speed, return true.
        */
       [this, target_speed](double) {
-        if (other_status_.find(target_speed.reference_entity_name) == other_status_.end()) {
+        if (
+          target_speed.reference_entity_name == name or
+          not other_status_->contains(target_speed.reference_entity_name)) {
           return true;
         }
-        target_speed_ = target_speed.getAbsoluteValue(getStatus(), other_status_);
+        target_speed_ = target_speed.getAbsoluteValue(getStatus(), *other_status_);
         return false;
       },
       [this]() {}, job::Type::LINEAR_VELOCITY, true, job::Event::POST_UPDATE);
@@ -632,11 +636,13 @@ void EntityBase::requestSpeedChange(
        * @brief If the target entity reaches the target speed, return true.
        */
       [this, target_speed](double) {
-        if (other_status_.find(target_speed.reference_entity_name) == other_status_.end()) {
+        if (
+          target_speed.reference_entity_name == name or
+          not other_status_->contains(target_speed.reference_entity_name)) {
           return true;
         }
         if (isTargetSpeedReached(target_speed)) {
-          target_speed_ = target_speed.getAbsoluteValue(getStatus(), other_status_);
+          target_speed_ = target_speed.getAbsoluteValue(getStatus(), *other_status_);
           return true;
         }
         return false;
@@ -670,33 +676,14 @@ void EntityBase::setDynamicConstraints(
 }
 
 void EntityBase::setEntityTypeList(
-  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & entity_type_list)
+  const std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType> & entity_type_list)
 {
   entity_type_list_ = entity_type_list;
 }
 
-void EntityBase::setOtherStatus(
-  const std::unordered_map<std::string, CanonicalizedEntityStatus> & status)
-{
-  other_status_.clear();
-  for (const auto & [other_name, other_status] : status) {
-    if (other_name != name) {
-      /*
-         The following filtering is the code written for the purpose of
-         reducing the calculation load, but it is commented out experimentally
-         because it adversely affects "processing that needs to identify other
-         entities regardless of distance" such as RelativeTargetSpeed of
-         requestSpeedChange.
-      */
-      // const auto p0 = other_status.pose.position;
-      // const auto p1 = status_.pose.position;
-      // if (const auto distance = std::hypot(p0.x - p1.x, p0.y - p1.y, p0.z - p1.z); distance <
-      // 30)
-      // {
-      other_status_.emplace(other_name, other_status);
-      // }
-    }
-  }
+void EntityBase::setOtherStatus(const std::shared_ptr<const EntityStatusSnapshot> & status)
+{
+  other_status_ = status;
 }
 
 auto EntityBase::setStatus(const CanonicalizedEntityStatus & status) -> void
@@ -782,6 +769,15 @@ void EntityBase::activateOutOfRangeJob(
 
 auto EntityBase::setVelocityLimit(double) -> void {}
 
+auto EntityBase::resetForReuse() -> void
+{
+  cancelRequest();
+  status_before_update_ = status_;
+  stand_still_duration_ = 0.0;
+  traveled_distance_ = 0.0;
+  target_speed_ = std::nullopt;
+}
+
 void EntityBase::startNpcLogic() { npc_logic_started_ = true; }
 
 void EntityBase::stopAtCurrentPosition()
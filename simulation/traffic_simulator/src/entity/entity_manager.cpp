@@ -26,9 +26,11 @@
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
 #include <traffic_simulator/helper/helper.hpp>
 #include <traffic_simulator/helper/stop_watch.hpp>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace traffic_simulator
@@ -79,7 +81,7 @@ visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
 {
   visualization_msgs::msg::MarkerArray marker;
   for (const auto & entity : entities_) {
-    entity.second->appendDebugMarker(marker);
+    entity->appendDebugMarker(marker);
   }
   return marker;
 }
@@ -90,14 +92,15 @@ bool EntityManager::despawnEntity(const std::string & name)
     return false;
   }
 
-  entities_[name].reset(new DeletedEntity(name, getEntityStatus(name), hdmap_utils_ptr_));
+  entities_[toIndex(getEntityId(name))].reset(
+    new DeletedEntity(name, getEntityStatus(name), hdmap_utils_ptr_));
 
   return true;
 }
 
 bool EntityManager::entityExists(const std::string & name)
 {
-  return entities_.find(name) != std::end(entities_);
+  return entity_ids_.find(name) != std::end(entity_ids_);
 }
 
 auto EntityManager::getBoundingBoxDistance(const std::string & from, const std::string & to)
@@ -112,7 +115,7 @@ auto EntityManager::getCurrentTime() const noexcept -> double { return current_t
 auto EntityManager::getDistanceToCrosswalk(
   const std::string & name, const lanelet::Id target_crosswalk_id) -> std::optional<double>
 {
-  if (entities_.find(name) == entities_.end()) {
+  if (not entityExists(name)) {
     return std::nullopt;
   }
   if (getWaypoints(name).waypoints.empty()) {
@@ -126,7 +129,7 @@ auto EntityManager::getDistanceToCrosswalk(
 auto EntityManager::getDistanceToStopLine(
   const std::string & name, const lanelet::Id target_stop_line_id) -> std::optional<double>
 {
-  if (entities_.find(name) == entities_.end()) {
+  if (not entityExists(name)) {
     return std::nullopt;
   }
   if (getWaypoints(name).waypoints.empty()) {
@@ -137,14 +140,43 @@ auto EntityManager::getDistanceToStopLine(
   return spline.getCollisionPointIn2D(polygon);
 }
 
+auto EntityManager::getEntity(const EntityId id) const -> const std::unique_ptr<EntityBase> &
+{
+  if (toIndex(id) < entities_.size()) {
+    return entities_[toIndex(id)];
+  } else {
+    THROW_SEMANTIC_ERROR("entity with handle ", toIndex(id), " does not exist.");
+  }
+}
+
+auto EntityManager::getEntity(const std::string & name) const
+  -> const std::unique_ptr<EntityBase> &
+{
+  return entities_[toIndex(getEntityId(name))];
+}
+
+auto EntityManager::getEntityId(const std::string & name) const -> EntityId
+{
+  if (const auto iter = entity_ids_.find(name); iter == entity_ids_.end()) {
+    THROW_SEMANTIC_ERROR("entity ", std::quoted(name), " does not exist.");
+  } else {
+    return iter->second;
+  }
+}
+
+auto EntityManager::getEntityName(const EntityId id) const -> const std::string &
+{
+  return getEntity(id)->name;
+}
+
 auto EntityManager::getEntityNames() const -> const std::vector<std::string>
 {
   std::vector<std::string> names{};
-  for (const auto & each : entities_) {
+  for (const auto & entity : entities_) {
     // Add filter for DeletedEntity because this list is used on SimpleSensorSimulator which do not
     // know DeletedEntity.
-    if (each.second->getEntityType().type != DeletedEntity::ENTITY_TYPE_ID) {
-      names.push_back(each.first);
+    if (entity->getEntityType().type != DeletedEntity::ENTITY_TYPE_ID) {
+      names.push_back(entity->name);
     }
   }
   return names;
@@ -152,23 +184,20 @@ auto EntityManager::getEntityNames() const -> const std::vector<std::string>
 
 auto EntityManager::getEntityStatus(const std::string & name) const -> CanonicalizedEntityStatus
 {
-  if (const auto iter = entities_.find(name); iter == entities_.end()) {
-    THROW_SEMANTIC_ERROR("entity ", std::quoted(name), " does not exist.");
-  } else {
-    auto entity_status = static_cast<EntityStatus>(iter->second->getStatus());
-    assert(entity_status.name == name && "The entity name in status is different from key!");
-    entity_status.action_status.current_action = getCurrentAction(name);
-    entity_status.time = current_time_;
-    return CanonicalizedEntityStatus(entity_status, hdmap_utils_ptr_);
-  }
+  const auto & entity = getEntity(name);
+  auto entity_status = static_cast<EntityStatus>(entity->getStatus());
+  assert(entity_status.name == name && "The entity name in status is different from key!");
+  entity_status.action_status.current_action = entity->getCurrentAction();
+  entity_status.time = current_time_;
+  return CanonicalizedEntityStatus(entity_status, hdmap_utils_ptr_);
 }
 
 auto EntityManager::getEntityTypeList() const
-  -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>
+  -> const std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType>
 {
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> ret;
-  for (auto && [name, entity] : entities_) {
-    ret.emplace(name, getEntityType(name));
+  std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType> ret;
+  for (std::size_t index = 0; index < entities_.size(); ++index) {
+    ret.emplace(static_cast<EntityId>(index), entities_[index]->getEntityType());
   }
   return ret;
 }
@@ -497,7 +526,7 @@ auto EntityManager::getLongitudinalDistance(
 auto EntityManager::getNumberOfEgo() const -> std::size_t
 {
   return std::count_if(std::begin(entities_), std::end(entities_), [this](const auto & each) {
-    return isEgo(each.first);
+    return isEgo(each->name);
   });
 }
 
@@ -514,13 +543,19 @@ const std::string EntityManager::getEgoName() const
     "but ego vehicle does not exist");
 }
 
-auto EntityManager::getObstacle(const std::string & name)
+auto EntityManager::getObstacle(const EntityId id)
   -> std::optional<traffic_simulator_msgs::msg::Obstacle>
 {
   if (!npc_logic_started_) {
     return std::nullopt;
   }
-  return entities_.at(name)->getObstacle();
+  return getEntity(id)->getObstacle();
+}
+
+auto EntityManager::getObstacle(const std::string & name)
+  -> std::optional<traffic_simulator_msgs::msg::Obstacle>
+{
+  return getObstacle(getEntityId(name));
 }
 
 auto EntityManager::getRelativePose(
@@ -576,22 +611,29 @@ auto EntityManager::getRelativePose(
 
 auto EntityManager::getStepTime() const noexcept -> double { return step_time_; }
 
-auto EntityManager::getWaypoints(const std::string & name)
-  -> traffic_simulator_msgs::msg::WaypointsArray
+auto EntityManager::getWaypoints(const EntityId id) -> traffic_simulator_msgs::msg::WaypointsArray
 {
   if (!npc_logic_started_) {
     return traffic_simulator_msgs::msg::WaypointsArray();
   }
-  return entities_.at(name)->getWaypoints();
+  return getEntity(id)->getWaypoints();
+}
+
+auto EntityManager::getWaypoints(const std::string & name)
+  -> traffic_simulator_msgs::msg::WaypointsArray
+{
+  return getWaypoints(getEntityId(name));
 }
 
-bool EntityManager::isEgo(const std::string & name) const
+bool EntityManager::isEgo(const EntityId id) const
 {
   using traffic_simulator_msgs::msg::EntityType;
-  return getEntityType(name).type == EntityType::EGO and
-         dynamic_cast<EgoEntity const *>(entities_.at(name).get());
+  return getEntityType(id).type == EntityType::EGO and
+         dynamic_cast<EgoEntity const *>(getEntity(id).get());
 }
 
+bool EntityManager::isEgo(const std::string & name) const { return isEgo(getEntityId(name)); }
+
 bool EntityManager::isEgoSpawned() const
 {
   for (const auto & name : getEntityNames()) {
@@ -676,7 +718,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, continuous);
 }
 
 void EntityManager::requestSpeedChange(
@@ -686,7 +728,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
 }
 
 void EntityManager::requestSpeedChange(
@@ -695,7 +737,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, continuous);
 }
 
 void EntityManager::requestSpeedChange(
@@ -706,7 +748,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
 }
 
 auto EntityManager::setEntityStatus(
@@ -717,7 +759,7 @@ auto EntityManager::setEntityStatus(
       "You cannot set entity status to the ego vehicle name ", std::quoted(name),
       " after starting scenario.");
   } else {
-    entities_.at(name)->setStatus(status);
+    getEntity(name)->setStatus(status);
   }
 }
 
@@ -729,7 +771,7 @@ auto EntityManager::setEntityStatusExternally(
       "You cannot set entity status externally to the vehicle other than ego named ",
       std::quoted(name), ".");
   } else {
-    dynamic_cast<EgoEntity *>(entities_[name].get())->setStatusExternally(status);
+    dynamic_cast<EgoEntity *>(getEntity(name).get())->setStatusExternally(status);
   }
 }
 
@@ -737,7 +779,7 @@ void EntityManager::setVerbose(const bool verbose)
 {
   configuration.verbose = verbose;
   for (auto & entity : entities_) {
-    entity.second->verbose = verbose;
+    entity->verbose = verbose;
   }
 }
 
@@ -748,16 +790,17 @@ auto EntityManager::toMapPose(const CanonicalizedLaneletPose & lanelet_pose) con
 }
 
 auto EntityManager::updateNpcLogic(
-  const std::string & name,
-  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
+  const EntityId id,
+  const std::unordered_map<EntityId, traffic_simulator_msgs::msg::EntityType> & type_list)
   -> const CanonicalizedEntityStatus &
 {
+  const auto & entity = getEntity(id);
   if (configuration.verbose) {
-    std::cout << "update " << name << " behavior" << std::endl;
+    std::cout << "update " << entity->name << " behavior" << std::endl;
   }
-  entities_[name]->setEntityTypeList(type_list);
-  entities_[name]->onUpdate(current_time_, step_time_);
-  return entities_[name]->getStatus();
+  entity->setEntityTypeList(type_list);
+  entity->onUpdate(current_time_, step_time_);
+  return entity->getStatus();
 }
 
 void EntityManager::update(const double current_time, const double step_time)
@@ -773,35 +816,61 @@ void EntityManager::update(const double current_time, const double step_time)
     v2i_traffic_light_updater_.createTimer(configuration.v2i_traffic_light_publish_rate);
   }
   auto type_list = getEntityTypeList();
-  std::unordered_map<std::string, CanonicalizedEntityStatus> all_status;
-  for (auto && [name, entity] : entities_) {
-    all_status.emplace(name, entity->getStatus());
+  EntityStatusSnapshot::Statuses all_status;
+  all_status.reserve(entities_.size());
+  for (std::size_t index = 0; index < entities_.size(); ++index) {
+    all_status.emplace_back(static_cast<EntityId>(index), entities_[index]->getStatus());
   }
-  for (auto && [name, entity] : entities_) {
-    entity->setOtherStatus(all_status);
+  auto snapshot = std::make_shared<const EntityStatusSnapshot>(std::move(all_status));
+  for (const auto & entity : entities_) {
+    entity->setOtherStatus(snapshot);
   }
   all_status.clear();
-  for (auto && [name, entity] : entities_) {
-    all_status.emplace(name, updateNpcLogic(name, type_list));
+  if (npc_logic_thread_pool_) {
+    /*
+       Each entity reads only the snapshot shared above and writes only its own
+       status, so NPCs are updated concurrently. Ego entities interact with
+       Autoware and are updated on this thread. The snapshot below is built in
+       the order of entities_ regardless of which thread updated each entity.
+    */
+    std::vector<EntityId> npc_ids;
+    for (std::size_t index = 0; index < entities_.size(); ++index) {
+      if (const auto id = static_cast<EntityId>(index); isEgo(id)) {
+        updateNpcLogic(id, type_list);
+      } else {
+        npc_ids.push_back(id);
+      }
+    }
+    npc_logic_thread_pool_->parallelFor(
+      npc_ids.size(), [&](const auto index) { updateNpcLogic(npc_ids[index], type_list); });
+    for (std::size_t index = 0; index < entities_.size(); ++index) {
+      all_status.emplace_back(static_cast<EntityId>(index), entities_[index]->getStatus());
+    }
+  } else {
+    for (std::size_t index = 0; index < entities_.size(); ++index) {
+      const auto id = static_cast<EntityId>(index);
+      all_status.emplace_back(id, updateNpcLogic(id, type_list));
+    }
   }
-  for (auto && [name, entity] : entities_) {
-    entity->setOtherStatus(all_status);
+  snapshot = std::make_shared<const EntityStatusSnapshot>(std::move(all_status));
+  for (const auto & entity : entities_) {
+    entity->setOtherStatus(snapshot);
   }
   traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
-  for (auto && [name, status] : all_status) {
+  for (auto && [id, status] : snapshot->getStatuses()) {
     traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_trajectory;
-    status_with_trajectory.waypoint = getWaypoints(name);
-    for (const auto & goal : getGoalPoses<geometry_msgs::msg::Pose>(name)) {
+    status_with_trajectory.waypoint = getWaypoints(id);
+    for (const auto & goal : getGoalPoses<geometry_msgs::msg::Pose>(id)) {
       status_with_trajectory.goal_pose.push_back(goal);
     }
-    if (const auto obstacle = getObstacle(name); obstacle) {
+    if (const auto obstacle = getObstacle(id); obstacle) {
       status_with_trajectory.obstacle = obstacle.value();
       status_with_trajectory.obstacle_find = true;
     } else {
       status_with_trajectory.obstacle_find = false;
     }
     status_with_trajectory.status = static_cast<EntityStatus>(status);
-    status_with_trajectory.name = name;
+    status_with_trajectory.name = status.getName();
     status_with_trajectory.time = current_time + step_time;
     status_array_msg.data.emplace_back(status_with_trajectory);
   }
@@ -828,8 +897,8 @@ void EntityManager::updateHdmapMarker()
 void EntityManager::startNpcLogic()
 {
   npc_logic_started_ = true;
-  for (auto it = entities_.begin(); it != entities_.end(); it++) {
-    it->second->startNpcLogic();
+  for (const auto & entity : entities_) {
+    entity->startNpcLogic();
   }
 }
 
@@ -0,0 +1,147 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+EntityStatusSnapshot::EntityStatusSnapshot(Statuses && statuses) : statuses_(std::move(statuses))
+{
+  entries_by_name_.reserve(statuses_.size());
+  for (const auto & entry : statuses_) {
+    const auto & [id, status] = entry;
+    if (entries_by_id_.size() <= toIndex(id)) {
+      entries_by_id_.resize(toIndex(id) + 1, nullptr);
+    }
+    entries_by_id_[toIndex(id)] = &entry;
+    entries_by_name_.emplace(status.getName(), &entry);
+    const auto position = status.getMapPose().position;
+    cells_[getCellKey(getCellIndex(position.x), getCellIndex(position.y))].push_back(&entry);
+    if (status.laneMatchingSucceed()) {
+      lanelet_index_[status.getLaneletPose().lanelet_id].push_back(&entry);
+    }
+    const auto & bounding_box = status.getBoundingBox();
+    max_bounding_radius_ = std::max(
+      max_bounding_radius_,
+      std::hypot(
+        std::abs(bounding_box.center.x) + bounding_box.dimensions.x * 0.5,
+        std::abs(bounding_box.center.y) + bounding_box.dimensions.y * 0.5));
+  }
+}
+
+auto EntityStatusSnapshot::contains(const EntityId id) const -> bool
+{
+  return toIndex(id) < entries_by_id_.size() and entries_by_id_[toIndex(id)];
+}
+
+auto EntityStatusSnapshot::at(const EntityId id) const -> const CanonicalizedEntityStatus &
+{
+  if (contains(id)) {
+    return entries_by_id_[toIndex(id)]->second;
+  }
+  THROW_SIMULATION_ERROR(
+    "entity with handle ", toIndex(id), " does not exist in the entity status snapshot.");
+}
+
+auto EntityStatusSnapshot::contains(const std::string & name) const -> bool
+{
+  return entries_by_name_.find(name) != entries_by_name_.end();
+}
+
+auto EntityStatusSnapshot::at(const std::string & name) const -> const CanonicalizedEntityStatus &
+{
+  if (const auto iter = entries_by_name_.find(name); iter != entries_by_name_.end()) {
+    return iter->second->second;
+  }
+  THROW_SIMULATION_ERROR("entity : ", name, " does not exist in the entity status snapshot.");
+}
+
+auto EntityStatusSnapshot::getEntityId(const std::string & name) const -> std::optional<EntityId>
+{
+  if (const auto iter = entries_by_name_.find(name); iter != entries_by_name_.end()) {
+    return iter->second->first;
+  }
+  return std::nullopt;
+}
+
+auto EntityStatusSnapshot::getEntitiesOnLanelet(const lanelet::Id lanelet_id) const
+  -> const std::vector<const Entry *> &
+{
+  static const std::vector<const Entry *> empty;
+  if (const auto iter = lanelet_index_.find(lanelet_id); iter != lanelet_index_.end()) {
+    return iter->second;
+  }
+  return empty;
+}
+
+auto EntityStatusSnapshot::getEntitiesNear(
+  const geometry_msgs::msg::Point & point, const double distance) const
+  -> std::vector<const Entry *>
+{
+  const double search_radius = distance + max_bounding_radius_;
+  const auto is_near = [&](const Entry & entry) {
+    const auto position = entry.second.getMapPose().position;
+    return std::hypot(position.x - point.x, position.y - point.y) <= search_radius;
+  };
+
+  std::vector<const Entry *> entries;
+  if (const double cells_to_probe = std::pow(2.0 * search_radius / cell_size + 2.0, 2);
+      not std::isfinite(cells_to_probe) or cells_to_probe > cells_.size()) {
+    /// @note Visiting every occupied cell is cheaper than probing mostly empty ones.
+    for (const auto & [key, cell] : cells_) {
+      std::copy_if(cell.begin(), cell.end(), std::back_inserter(entries), [&](const auto entry) {
+        return is_near(*entry);
+      });
+    }
+    return entries;
+  }
+  const auto x_min = getCellIndex(point.x - search_radius);
+  const auto x_max = getCellIndex(point.x + search_radius);
+  const auto y_min = getCellIndex(point.y - search_radius);
+  const auto y_max = getCellIndex(point.y + search_radius);
+  for (auto x_index = x_min; x_index <= x_max; ++x_index) {
+    for (auto y_index = y_min; y_index <= y_max; ++y_index) {
+      if (const auto iter = cells_.find(getCellKey(x_index, y_index)); iter != cells_.end()) {
+        std::copy_if(
+          iter->second.begin(), iter->second.end(), std::back_inserter(entries),
+          [&](const auto entry) { return is_near(*entry); });
+      }
+    }
+  }
+  return entries;
+}
+
+auto EntityStatusSnapshot::getCellKey(
+  const std::int64_t x_index, const std::int64_t y_index) const noexcept -> CellKey
+{
+  return static_cast<CellKey>(
+    (static_cast<std::uint64_t>(x_index) << 32) ^
+    (static_cast<std::uint64_t>(y_index) & 0xFFFFFFFF));
+}
+
+auto EntityStatusSnapshot::getCellIndex(const double coordinate) const -> std::int64_t
+{
+  return static_cast<std::int64_t>(std::floor(coordinate / cell_size));
+}
+}  // namespace entity
+}  // namespace traffic_simulator
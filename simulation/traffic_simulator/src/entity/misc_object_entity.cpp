@@ -42,7 +42,7 @@ auto MiscObjectEntity::getCurrentAction() const -> std::string
   if (not npc_logic_started_) {
     return "waiting";
   } else {
-    return static_cast<EntityStatus>(status_).action_status.current_action;
+    return static_cast<const EntityStatus &>(status_).action_status.current_action;
   }
 }
 
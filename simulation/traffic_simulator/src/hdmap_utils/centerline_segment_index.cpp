@@ -0,0 +1,108 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <traffic_simulator/hdmap_utils/centerline_segment_index.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hdmap_utils
+{
+CenterlineSegmentIndex::CenterlineSegmentIndex(std::vector<Segment> && segments)
+: segments_(std::move(segments)), rtree_([this]() {
+    std::vector<std::pair<Box, std::size_t>> values;
+    values.reserve(segments_.size());
+    for (std::size_t i = 0; i < segments_.size(); ++i) {
+      const auto & segment = segments_[i];
+      values.emplace_back(
+        Box(
+          Point(std::min(segment.start.x, segment.end.x), std::min(segment.start.y, segment.end.y)),
+          Point(std::max(segment.start.x, segment.end.x), std::max(segment.start.y, segment.end.y))),
+        i);
+    }
+    return values;
+  }())
+{
+}
+
+auto CenterlineSegmentIndex::makeSegments(
+  const lanelet::Id lanelet_id, const std::vector<geometry_msgs::msg::Point> & center_points,
+  const bool is_crosswalk) -> std::vector<Segment>
+{
+  std::vector<Segment> segments;
+  double s = 0;
+  for (std::size_t i = 1; i < center_points.size(); ++i) {
+    segments.push_back({lanelet_id, is_crosswalk, s, center_points[i - 1], center_points[i]});
+    s += std::hypot(
+      center_points[i].x - center_points[i - 1].x, center_points[i].y - center_points[i - 1].y,
+      center_points[i].z - center_points[i - 1].z);
+  }
+  return segments;
+}
+
+auto CenterlineSegmentIndex::getNearbyLanelets(
+  const geometry_msgs::msg::Point & point, const double distance_threshold,
+  const bool include_crosswalk) const -> std::vector<Match>
+{
+  std::vector<std::pair<Box, std::size_t>> candidates;
+  rtree_.query(
+    boost::geometry::index::intersects(Box(
+      Point(point.x - distance_threshold, point.y - distance_threshold),
+      Point(point.x + distance_threshold, point.y + distance_threshold))),
+    std::back_inserter(candidates));
+
+  std::unordered_map<lanelet::Id, Match> nearest_matches;
+  for (const auto & candidate : candidates) {
+    const auto & segment = segments_[candidate.second];
+    if (segment.is_crosswalk and not include_crosswalk) {
+      continue;
+    }
+    const double dx = segment.end.x - segment.start.x;
+    const double dy = segment.end.y - segment.start.y;
+    const double squared_length_2d = dx * dx + dy * dy;
+    const double t =
+      squared_length_2d <= 0
+        ? 0.0
+        : std::clamp(
+            ((point.x - segment.start.x) * dx + (point.y - segment.start.y) * dy) /
+              squared_length_2d,
+            0.0, 1.0);
+    const double distance = std::hypot(
+      point.x - (segment.start.x + t * dx), point.y - (segment.start.y + t * dy));
+    if (distance > distance_threshold) {
+      continue;
+    }
+    const double s =
+      segment.s + t * std::hypot(dx, dy, segment.end.z - segment.start.z);
+    if (const auto iter = nearest_matches.find(segment.lanelet_id);
+        iter == nearest_matches.end() or distance < iter->second.distance) {
+      nearest_matches[segment.lanelet_id] = {segment.lanelet_id, s, distance};
+    }
+  }
+
+  std::vector<Match> matches;
+  matches.reserve(nearest_matches.size());
+  for (const auto & [lanelet_id, match] : nearest_matches) {
+    matches.push_back(match);
+  }
+  std::sort(matches.begin(), matches.end(), [](const auto & lhs, const auto & rhs) {
+    return lhs.distance < rhs.distance or
+           (lhs.distance == rhs.distance and lhs.lanelet_id < rhs.lanelet_id);
+  });
+  return matches;
+}
+}  // namespace hdmap_utils
@@ -39,6 +39,7 @@
 #include <lanelet2_extension/visualization/visualization.hpp>
 #include <memory>
 #include <optional>
+#include <queue>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
 #include <string>
@@ -83,6 +84,31 @@ HdMapUtils::HdMapUtils(
   all_graphs.push_back(pedestrian_routing_graph_ptr_);
   shoulder_lanelets_ =
     lanelet::utils::query::shoulderLanelets(lanelet::utils::query::laneletLayer(lanelet_map_ptr_));
+  lanelet_geometry_table_ = [this]() {
+    std::vector<std::pair<lanelet::Id, LaneletGeometryTable::Geometry>> geometries;
+    for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+      auto center_points = calculateCenterPoints(lanelet);
+      auto spline = std::make_shared<math::geometry::CatmullRomSpline>(center_points);
+      geometries.emplace_back(
+        lanelet.id(), LaneletGeometryTable::Geometry{
+                        lanelet::utils::getLaneletLength2d(lanelet), std::move(center_points),
+                        std::move(spline)});
+    }
+    return LaneletGeometryTable(std::move(geometries));
+  }();
+  centerline_segment_index_ = [this]() {
+    std::vector<CenterlineSegmentIndex::Segment> segments;
+    for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+      const auto is_crosswalk =
+        lanelet.attributeOr(lanelet::AttributeName::Subtype, "") ==
+        std::string(lanelet::AttributeValueString::Crosswalk);
+      for (auto && segment : CenterlineSegmentIndex::makeSegments(
+             lanelet.id(), getCenterPoints(lanelet.id()), is_crosswalk)) {
+        segments.push_back(std::move(segment));
+      }
+    }
+    return CenterlineSegmentIndex(std::move(segments));
+  }();
 }
 
 auto HdMapUtils::getAllCanonicalizedLaneletPoses(
@@ -317,7 +343,7 @@ auto HdMapUtils::getCollisionPointInLaneCoordinate(
   using Point = bg::model::d2::point_xy<double>;
   using Line = bg::model::linestring<Point>;
   using Polygon = bg::model::polygon<Point, false>;
-  auto center_points = getCenterPoints(lanelet_id);
+  const auto & center_points = getCenterPoints(lanelet_id);
   std::vector<Point> path_collision_points;
   lanelet_map_ptr_->laneletLayer.get(crossing_lanelet_id);
   lanelet::CompoundPolygon3d lanelet_polygon =
@@ -397,44 +423,36 @@ auto HdMapUtils::clipTrajectoryFromLaneletIds(
   const double forward_distance) const -> std::vector<geometry_msgs::msg::Point>
 {
   std::vector<geometry_msgs::msg::Point> ret;
+  const auto append_points = [&](const lanelet::Id id, const double start_s, const double end_s) {
+    std::vector<double> s_values;
+    for (double s_val = start_s; s_val < end_s; s_val = s_val + 1.0) {
+      s_values.push_back(s_val);
+    }
+    const auto points = toMapPoints(id, s_values);
+    ret.insert(ret.end(), points.begin(), points.end());
+  };
   bool on_traj = false;
   double rest_distance = forward_distance;
   for (auto id_itr = lanelet_ids.begin(); id_itr != lanelet_ids.end(); id_itr++) {
     double l = getLaneletLength(*id_itr);
     if (on_traj) {
       if (rest_distance < l) {
-        for (double s_val = 0; s_val < rest_distance; s_val = s_val + 1.0) {
-          ret.emplace_back(
-            toMapPose(traffic_simulator::helper::constructLaneletPose(*id_itr, s_val, 0))
-              .pose.position);
-        }
+        append_points(*id_itr, 0, rest_distance);
         break;
       } else {
         rest_distance = rest_distance - l;
-        for (double s_val = 0; s_val < l; s_val = s_val + 1.0) {
-          ret.emplace_back(
-            toMapPose(traffic_simulator::helper::constructLaneletPose(*id_itr, s_val, 0.0))
-              .pose.position);
-        }
+        append_points(*id_itr, 0, l);
         continue;
       }
     }
     if (lanelet_id == *id_itr) {
       on_traj = true;
       if ((s + forward_distance) < l) {
-        for (double s_val = s; s_val < s + forward_distance; s_val = s_val + 1.0) {
-          ret.emplace_back(
-            toMapPose(traffic_simulator::helper::constructLaneletPose(lanelet_id, s_val, 0.0))
-              .pose.position);
-        }
+        append_points(lanelet_id, s, s + forward_distance);
         break;
       } else {
         rest_distance = rest_distance - (l - s);
-        for (double s_val = s; s_val < l; s_val = s_val + 1.0) {
-          ret.emplace_back(
-            toMapPose(traffic_simulator::helper::constructLaneletPose(lanelet_id, s_val, 0.0))
-              .pose.position);
-        }
+        append_points(lanelet_id, s, l);
         continue;
       }
     }
@@ -541,14 +559,34 @@ auto HdMapUtils::toLaneletPose(
   const geometry_msgs::msg::Pose & pose, const bool include_crosswalk,
   const double matching_distance) const -> std::optional<traffic_simulator_msgs::msg::LaneletPose>
 {
+  /**
+   * @note Hard coded parameter. Allowed deviation between the centerline polyline stored in the
+   * index and the spline interpolating the same points.
+   */
+  constexpr double centerline_margin = 0.5;
+  /**
+   * @note The candidate lanelets and their order are the ones of the lanelet polygons within 0.1 m
+   * of the position, as before the index existed. The index only gives each candidate a first guess
+   * of s, so that the spline is solved around it instead of along the whole lanelet. A candidate
+   * whose centerline is farther than matching_distance + centerline_margin cannot match anyway.
+   */
   const auto lanelet_ids = getNearbyLaneletIds(pose.position, 0.1, include_crosswalk);
   if (lanelet_ids.empty()) {
     return std::nullopt;
   }
-  for (const auto & id : lanelet_ids) {
-    const auto lanelet_pose = toLaneletPose(pose, id, matching_distance);
-    if (lanelet_pose) {
-      return lanelet_pose;
+  const auto matches = centerline_segment_index_.getNearbyLanelets(
+    pose.position, matching_distance + centerline_margin, true);
+  for (const auto & lanelet_id : lanelet_ids) {
+    if (const auto match = std::find_if(
+          matches.begin(), matches.end(),
+          [&](const auto & each) { return each.lanelet_id == lanelet_id; });
+        match != matches.end()) {
+      const auto spline = getCenterPointsSpline(lanelet_id);
+      if (const auto s = spline->getSValue(pose, matching_distance, match->s)) {
+        if (const auto lanelet_pose = toLaneletPose(pose, lanelet_id, *spline, s.value())) {
+          return lanelet_pose;
+        }
+      }
     }
   }
   return std::nullopt;
@@ -559,14 +597,22 @@ auto HdMapUtils::toLaneletPose(
   const double matching_distance) const -> std::optional<traffic_simulator_msgs::msg::LaneletPose>
 {
   const auto spline = getCenterPointsSpline(lanelet_id);
-  const auto s = spline->getSValue(pose, matching_distance);
-  if (!s) {
+  if (const auto s = spline->getSValue(pose, matching_distance)) {
+    return toLaneletPose(pose, lanelet_id, *spline, s.value());
+  } else {
     return std::nullopt;
   }
-  auto pose_on_centerline = spline->getPose(s.value());
+}
+
+auto HdMapUtils::toLaneletPose(
+  const geometry_msgs::msg::Pose & pose, const lanelet::Id lanelet_id,
+  const math::geometry::CatmullRomSpline & spline, const double s) const
+  -> std::optional<traffic_simulator_msgs::msg::LaneletPose>
+{
+  auto pose_on_centerline = spline.getPose(s);
   auto rpy = quaternion_operation::convertQuaternionToEulerAngle(
     quaternion_operation::getRotation(pose_on_centerline.orientation, pose.orientation));
-  double offset = std::sqrt(spline->getSquaredDistanceIn2D(pose.position, s.value()));
+  double offset = std::sqrt(spline.getSquaredDistanceIn2D(pose.position, s));
   /**
    * @note Hard coded parameter
    */
@@ -575,13 +621,13 @@ auto HdMapUtils::toLaneletPose(
     return std::nullopt;
   }
   double inner_prod = math::geometry::innerProduct(
-    spline->getNormalVector(s.value()), spline->getSquaredDistanceVector(pose.position, s.value()));
+    spline.getNormalVector(s), spline.getSquaredDistanceVector(pose.position, s));
   if (inner_prod < 0) {
     offset = offset * -1;
   }
   traffic_simulator_msgs::msg::LaneletPose lanelet_pose;
   lanelet_pose.lanelet_id = lanelet_id;
-  lanelet_pose.s = s.value();
+  lanelet_pose.s = s;
   lanelet_pose.offset = offset;
   lanelet_pose.rpy = rpy;
   return lanelet_pose;
@@ -842,70 +888,67 @@ auto HdMapUtils::getFollowingLanelets(
 }
 
 auto HdMapUtils::getRoute(const lanelet::Id from_lanelet_id, const lanelet::Id to_lanelet_id) const
-  -> lanelet::Ids
+  -> const lanelet::Ids &
 {
-  if (route_cache_.exists(from_lanelet_id, to_lanelet_id)) {
-    return route_cache_.getRoute(from_lanelet_id, to_lanelet_id);
+  if (const auto route = route_cache_.find(from_lanelet_id, to_lanelet_id)) {
+    return *route;
   }
   lanelet::Ids ids;
   const auto lanelet = lanelet_map_ptr_->laneletLayer.get(from_lanelet_id);
   const auto to_lanelet = lanelet_map_ptr_->laneletLayer.get(to_lanelet_id);
-  lanelet::Optional<lanelet::routing::Route> route =
-    vehicle_routing_graph_ptr_->getRoute(lanelet, to_lanelet, 0, false);
-  if (!route) {
-    route_cache_.appendData(from_lanelet_id, to_lanelet_id, ids);
-    return ids;
-  }
-  lanelet::routing::LaneletPath shortest_path = route->shortestPath();
-  if (shortest_path.empty()) {
-    route_cache_.appendData(from_lanelet_id, to_lanelet_id, ids);
-    return ids;
-  }
-  for (auto lane_itr = shortest_path.begin(); lane_itr != shortest_path.end(); lane_itr++) {
-    ids.push_back(lane_itr->id());
+  if (
+    lanelet::Optional<lanelet::routing::Route> route =
+      vehicle_routing_graph_ptr_->getRoute(lanelet, to_lanelet, 0, false)) {
+    for (const auto & path_lanelet : route->shortestPath()) {
+      ids.push_back(path_lanelet.id());
+    }
   }
-  route_cache_.appendData(from_lanelet_id, to_lanelet_id, ids);
-  return ids;
+  return *route_cache_.appendData(from_lanelet_id, to_lanelet_id, std::move(ids));
 }
 
 auto HdMapUtils::getCenterPointsSpline(const lanelet::Id lanelet_id) const
   -> std::shared_ptr<math::geometry::CatmullRomSpline>
 {
-  getCenterPoints(lanelet_id);
-  return center_points_cache_.getCenterPointsSpline(lanelet_id);
+  return lanelet_geometry_table_.getCenterPointsSpline(lanelet_id);
+}
+
+auto HdMapUtils::getCenterPointsSpline(const lanelet::Ids & lanelet_ids) const
+  -> std::shared_ptr<math::geometry::CatmullRomSpline>
+{
+  if (lanelet_ids.size() == 1) {
+    return getCenterPointsSpline(lanelet_ids.front());
+  }
+  std::vector<std::shared_ptr<math::geometry::CatmullRomSpline>> splines;
+  splines.reserve(lanelet_ids.size());
+  for (const auto lanelet_id : lanelet_ids) {
+    splines.push_back(getCenterPointsSpline(lanelet_id));
+  }
+  return std::make_shared<math::geometry::CatmullRomSpline>(splines);
 }
 
 auto HdMapUtils::getCenterPoints(const lanelet::Ids & lanelet_ids) const
   -> std::vector<geometry_msgs::msg::Point>
 {
   std::vector<geometry_msgs::msg::Point> ret;
-  if (lanelet_ids.empty()) {
-    return ret;
-  }
   for (const auto lanelet_id : lanelet_ids) {
-    ret += getCenterPoints(lanelet_id);
+    const auto & center_points = lanelet_geometry_table_.getCenterPoints(lanelet_id);
+    ret.insert(ret.end(), center_points.begin(), center_points.end());
   }
   ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
   return ret;
 }
 
 auto HdMapUtils::getCenterPoints(const lanelet::Id lanelet_id) const
+  -> const std::vector<geometry_msgs::msg::Point> &
+{
+  return lanelet_geometry_table_.getCenterPoints(lanelet_id);
+}
+
+auto HdMapUtils::calculateCenterPoints(const lanelet::ConstLanelet & lanelet) const
   -> std::vector<geometry_msgs::msg::Point>
 {
   std::vector<geometry_msgs::msg::Point> ret;
-  if (!lanelet_map_ptr_) {
-    THROW_SIMULATION_ERROR("lanelet map is null pointer");
-  }
-  if (lanelet_map_ptr_->laneletLayer.empty()) {
-    THROW_SIMULATION_ERROR("lanelet layer is empty");
-  }
-  if (center_points_cache_.exists(lanelet_id)) {
-    return center_points_cache_.getCenterPoints(lanelet_id);
-  }
-
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto centerline = lanelet.centerline();
-  for (const auto & point : centerline) {
+  for (const auto & point : lanelet.centerline()) {
     geometry_msgs::msg::Point p;
     p.x = point.x();
     p.y = point.y();
@@ -924,18 +967,12 @@ auto HdMapUtils::getCenterPoints(const lanelet::Id lanelet_id) const
     ret.push_back(p1);
     ret.push_back(p2);
   }
-  center_points_cache_.appendData(lanelet_id, ret);
   return ret;
 }
 
 auto HdMapUtils::getLaneletLength(const lanelet::Id lanelet_id) const -> double
 {
-  if (lanelet_length_cache_.exists(lanelet_id)) {
-    return lanelet_length_cache_.getLength(lanelet_id);
-  }
-  double ret = lanelet::utils::getLaneletLength2d(lanelet_map_ptr_->laneletLayer.get(lanelet_id));
-  lanelet_length_cache_.appendData(lanelet_id, ret);
-  return ret;
+  return lanelet_geometry_table_.getLength(lanelet_id);
 }
 
 auto HdMapUtils::getPreviousRoadShoulderLanelet(const lanelet::Id lanelet_id) const -> lanelet::Ids
@@ -1382,12 +1419,7 @@ auto HdMapUtils::isInLanelet(const lanelet::Id lanelet_id, const double s) const
 auto HdMapUtils::toMapPoints(const lanelet::Id lanelet_id, const std::vector<double> & s) const
   -> std::vector<geometry_msgs::msg::Point>
 {
-  std::vector<geometry_msgs::msg::Point> ret;
-  const auto spline = getCenterPointsSpline(lanelet_id);
-  for (const auto & s_value : s) {
-    ret.push_back(spline->getPoint(s_value));
-  }
-  return ret;
+  return getCenterPointsSpline(lanelet_id)->getPoints(s);
 }
 
 auto HdMapUtils::toMapPose(const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) const
@@ -1437,7 +1469,7 @@ auto HdMapUtils::getLateralDistance(
   const traffic_simulator_msgs::msg::LaneletPose & from,
   const traffic_simulator_msgs::msg::LaneletPose & to) const -> std::optional<double>
 {
-  const auto route = getRoute(from.lanelet_id, to.lanelet_id);
+  const auto & route = getRoute(from.lanelet_id, to.lanelet_id);
   if (route.empty()) {
     return std::nullopt;
   }
@@ -1455,7 +1487,10 @@ auto HdMapUtils::getLongitudinalDistance(
       return to.s - from.s;
     }
   }
-  const auto route = getRoute(from.lanelet_id, to.lanelet_id);
+  if (const auto route_length = getRouteLength(from.lanelet_id, to.lanelet_id)) {
+    return route_length.value() - from.s + to.s;
+  }
+  const auto & route = getRoute(from.lanelet_id, to.lanelet_id);
   if (route.empty()) {
     return std::nullopt;
   }
@@ -1472,6 +1507,63 @@ auto HdMapUtils::getLongitudinalDistance(
   return distance;
 }
 
+/**
+ * @brief Get the length of the shortest route from the start of one lanelet to the start of another.
+ * @return std::nullopt if the lanelet "to" is not reachable within the radius of the distance oracle.
+ */
+auto HdMapUtils::getRouteLength(const lanelet::Id from_lanelet_id, const lanelet::Id to_lanelet_id)
+  const -> std::optional<double>
+{
+  /**
+   * @note Hard coded parameter. Radius of the route lengths calculated at once from one lanelet.
+   */
+  constexpr double max_route_length = 1000.0;
+  auto row = route_length_cache_.find(from_lanelet_id);
+  if (not row) {
+    row = route_length_cache_.appendData(
+      from_lanelet_id, calculateRouteLengths(from_lanelet_id, max_route_length));
+  }
+  if (const auto iter = row->find(to_lanelet_id); iter != row->end()) {
+    return iter->second;
+  } else {
+    return std::nullopt;
+  }
+}
+
+/**
+ * @brief Bounded Dijkstra search over the vehicle routing graph (without lane changes), with the
+ * same cost as the route returned by getRoute.
+ */
+auto HdMapUtils::calculateRouteLengths(const lanelet::Id from_lanelet_id, const double max_length)
+  const -> RouteLengthCache::Row
+{
+  RouteLengthCache::Row route_lengths{{from_lanelet_id, 0.0}};
+  using Candidate = std::pair<double, lanelet::Id>;
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+  candidates.emplace(0.0, from_lanelet_id);
+  while (not candidates.empty()) {
+    const auto [route_length, lanelet_id] = candidates.top();
+    candidates.pop();
+    if (route_length > route_lengths.at(lanelet_id)) {
+      continue;
+    }
+    const auto route_length_to_following = route_length + getLaneletLength(lanelet_id);
+    if (route_length_to_following > max_length) {
+      continue;
+    }
+    for (const auto & following : vehicle_routing_graph_ptr_->following(
+           lanelet_map_ptr_->laneletLayer.get(lanelet_id), false)) {
+      if (const auto [iter, inserted] =
+            route_lengths.try_emplace(following.id(), route_length_to_following);
+          inserted or route_length_to_following < iter->second) {
+        iter->second = route_length_to_following;
+        candidates.emplace(route_length_to_following, following.id());
+      }
+    }
+  }
+  return route_lengths;
+}
+
 auto HdMapUtils::toMapBin() const -> autoware_auto_mapping_msgs::msg::HADMapBin
 {
   std::stringstream ss;
@@ -0,0 +1,105 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <traffic_simulator/helper/thread_pool.hpp>
+
+namespace traffic_simulator
+{
+namespace helper
+{
+ThreadPool::ThreadPool(const std::size_t number_of_workers)
+{
+  workers_.reserve(number_of_workers);
+  for (std::size_t i = 0; i < number_of_workers; ++i) {
+    workers_.emplace_back([this]() { work(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  task_started_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+auto ThreadPool::parallelFor(
+  const std::size_t size, const std::function<void(std::size_t)> & function) -> void
+{
+  if (workers_.empty() or size <= 1) {
+    for (std::size_t i = 0; i < size; ++i) {
+      function(i);
+    }
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_ = size;
+    function_ = &function;
+    next_index_ = 0;
+    exceptions_.assign(size, nullptr);
+    running_workers_ = workers_.size();
+    ++generation_;
+  }
+  task_started_.notify_all();
+  runTasks();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_finished_.wait(lock, [this]() { return running_workers_ == 0; });
+    function_ = nullptr;
+  }
+  for (const auto & exception : exceptions_) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
+auto ThreadPool::work() -> void
+{
+  std::size_t finished_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_started_.wait(lock, [&]() { return stopped_ or generation_ != finished_generation; });
+      if (stopped_) {
+        return;
+      }
+      finished_generation = generation_;
+    }
+    runTasks();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --running_workers_;
+    }
+    task_finished_.notify_one();
+  }
+}
+
+auto ThreadPool::runTasks() -> void
+{
+  for (auto index = next_index_++; index < size_; index = next_index_++) {
+    try {
+      (*function_)(index);
+    } catch (...) {
+      exceptions_[index] = std::current_exception();
+    }
+  }
+}
+}  // namespace helper
+}  // namespace traffic_simulator
@@ -23,6 +23,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <traffic_simulator/data_type/lanelet_pose.hpp>
@@ -53,17 +54,37 @@ TrafficController::TrafficController(
 
 void TrafficController::autoSink()
 {
+  /// @note All dead ends share one sink so that each entity is checked once per frame.
+  std::vector<geometry_msgs::msg::Point> positions;
   for (const auto & lanelet_id : hdmap_utils_->getLaneletIds()) {
     if (hdmap_utils_->getNextLaneletIds(lanelet_id).empty()) {
       LaneletPose lanelet_pose;
       lanelet_pose.lanelet_id = lanelet_id;
       lanelet_pose.s = hdmap_utils_->getLaneletLength(lanelet_id);
-      const auto pose = hdmap_utils_->toMapPose(lanelet_pose);
-      addModule<traffic_simulator::traffic::TrafficSink>(
-        1, pose.pose.position, get_entity_names_function, get_entity_pose_function,
-        despawn_function);
+      positions.push_back(hdmap_utils_->toMapPose(lanelet_pose).pose.position);
     }
   }
+  if (not positions.empty()) {
+    addModule<traffic_simulator::traffic::TrafficSink>(
+      1, positions, get_entity_names_function, get_entity_pose_function,
+      [this](const auto & name) { despawn(name); });
+  }
+}
+
+void TrafficController::despawn(const std::string & name) const
+{
+  if (std::none_of(sources_.begin(), sources_.end(), [&](const auto & source) {
+        return source->release(name);
+      })) {
+    despawn_function(name);
+  }
+}
+
+void TrafficController::forget(const std::string & name) const
+{
+  for (const auto & source : sources_) {
+    source->forget(name);
+  }
 }
 
 void TrafficController::execute()
@@ -23,9 +23,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 #include <geometry/distance.hpp>
-#include <iostream>
 #include <memory>
 #include <string>
 #include <traffic_simulator/traffic/traffic_sink.hpp>
@@ -40,24 +42,70 @@ TrafficSink::TrafficSink(
   const std::function<std::vector<std::string>(void)> & get_entity_names_function,
   const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
   const std::function<void(std::string)> & despawn_function)
+: TrafficSink(
+    radius, std::vector<geometry_msgs::msg::Point>{position}, get_entity_names_function,
+    get_entity_pose_function, despawn_function)
+{
+}
+
+TrafficSink::TrafficSink(
+  double radius, const std::vector<geometry_msgs::msg::Point> & positions,
+  const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+  const std::function<void(std::string)> & despawn_function)
 : TrafficModuleBase(),
   radius(radius),
-  position(position),
+  positions(positions),
   get_entity_names_function(get_entity_names_function),
   get_entity_pose_function(get_entity_pose_function),
-  despawn_function(despawn_function)
+  despawn_function(despawn_function),
+  cell_size(std::max(radius, 1.0))
 {
+  for (const auto & position : positions) {
+    cells_[getCellKey(getCellIndex(position.x), getCellIndex(position.y))].push_back(position);
+  }
 }
 
 void TrafficSink::execute()
 {
-  const auto names = get_entity_names_function();
-  for (const auto & name : names) {
-    const auto pose = get_entity_pose_function(name);
-    if (math::geometry::getDistance(position, pose) <= radius) {
+  if (cells_.empty()) {
+    return;
+  }
+  for (const auto & name : get_entity_names_function()) {
+    if (isInside(get_entity_pose_function(name).position)) {
       despawn_function(name);
     }
   }
 }
+
+auto TrafficSink::isInside(const geometry_msgs::msg::Point & point) const -> bool
+{
+  const auto x_index = getCellIndex(point.x);
+  const auto y_index = getCellIndex(point.y);
+  for (auto x = x_index - 1; x <= x_index + 1; ++x) {
+    for (auto y = y_index - 1; y <= y_index + 1; ++y) {
+      if (const auto iter = cells_.find(getCellKey(x, y)); iter != cells_.end()) {
+        if (std::any_of(iter->second.begin(), iter->second.end(), [&](const auto & position) {
+              return math::geometry::getDistance(position, point) <= radius;
+            })) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+auto TrafficSink::getCellKey(const std::int64_t x_index, const std::int64_t y_index) const noexcept
+  -> CellKey
+{
+  return (static_cast<std::uint64_t>(x_index) << 32) ^
+         (static_cast<std::uint64_t>(y_index) & 0xFFFFFFFF);
+}
+
+auto TrafficSink::getCellIndex(const double coordinate) const -> std::int64_t
+{
+  return static_cast<std::int64_t>(std::floor(coordinate / cell_size));
+}
 }  // namespace traffic
 }  // namespace traffic_simulator
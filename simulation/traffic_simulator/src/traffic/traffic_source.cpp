@@ -0,0 +1,101 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <functional>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+TrafficSource::TrafficSource(
+  const std::string & name, double rate, std::size_t max_entities,
+  const std::vector<LaneletPose> & spawn_poses,
+  const std::function<double(void)> & get_current_time_function,
+  const std::function<bool(const LaneletPose &)> & is_spawn_pose_free_function,
+  const std::function<void(const std::string &, const LaneletPose &)> & spawn_function,
+  const std::function<void(const std::string &, const LaneletPose &)> & respawn_function)
+: TrafficModuleBase(),
+  name(name),
+  rate(rate),
+  max_entities(max_entities),
+  spawn_poses(spawn_poses),
+  get_current_time_function(get_current_time_function),
+  is_spawn_pose_free_function(is_spawn_pose_free_function),
+  spawn_function(spawn_function),
+  respawn_function(respawn_function)
+{
+  if (not(rate > 0.0)) {
+    THROW_SEMANTIC_ERROR("Rate of traffic source ", name, " must be positive, but ", rate, ".");
+  }
+  if (spawn_poses.empty()) {
+    THROW_SEMANTIC_ERROR("Traffic source ", name, " has no spawn pose.");
+  }
+}
+
+void TrafficSource::execute()
+{
+  const auto current_time = get_current_time_function();
+  if (not next_emission_time_) {
+    next_emission_time_ = current_time;
+  }
+  /// @note At most one vehicle per spawn pose per frame, even if the spawn poses look free.
+  for (std::size_t emitted = 0; emitted < spawn_poses.size() and
+                                entity_names_.size() < max_entities and
+                                isEmissionDue(current_time);
+       ++emitted) {
+    const auto entity_name = name + "_" + std::to_string(spawned_count_++);
+    spawn_function(entity_name, nextSpawnPose());
+    entity_names_.insert(entity_name);
+  }
+  /// @note Emissions missed while the population was full or the spawn pose was occupied are
+  /// dropped instead of bursting out.
+  next_emission_time_ = std::max(*next_emission_time_, current_time);
+}
+
+auto TrafficSource::release(const std::string & entity_name) -> bool
+{
+  if (const auto iter = entity_names_.find(entity_name); iter == entity_names_.end()) {
+    return false;
+  } else if (isEmissionDue(get_current_time_function())) {
+    respawn_function(entity_name, nextSpawnPose());
+    return true;
+  } else {
+    /// @note The entity is despawned as usual, and execute() emits a new one when it is due.
+    entity_names_.erase(iter);
+    return false;
+  }
+}
+
+void TrafficSource::forget(const std::string & entity_name) { entity_names_.erase(entity_name); }
+
+auto TrafficSource::isEmissionDue(const double current_time) const -> bool
+{
+  return next_emission_time_ and *next_emission_time_ <= current_time and
+         is_spawn_pose_free_function(spawn_poses[spawn_pose_index_]);
+}
+
+auto TrafficSource::nextSpawnPose() -> const LaneletPose &
+{
+  const auto & spawn_pose = spawn_poses[spawn_pose_index_];
+  spawn_pose_index_ = (spawn_pose_index_ + 1) % spawn_poses.size();
+  *next_emission_time_ += 1.0 / rate;
+  return spawn_pose;
+}
+}  // namespace traffic
+}  // namespace traffic_simulator
@@ -14,6 +14,8 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
 #include <type_traits>
@@ -39,14 +41,14 @@ auto TrafficLightManager::hasAnyLightChanged() -> bool
 
 auto TrafficLightManager::getTrafficLight(const lanelet::Id traffic_light_id) -> TrafficLight &
 {
-  if (auto iter = traffic_lights_.find(traffic_light_id); iter != std::end(traffic_lights_)) {
-    return iter->second;
-  } else {
-    traffic_lights_.emplace(
-      std::piecewise_construct, std::forward_as_tuple(traffic_light_id),
-      std::forward_as_tuple(traffic_light_id, *hdmap_));
-    return traffic_lights_.at(traffic_light_id);
+  {
+    std::shared_lock<std::shared_mutex> lock(traffic_lights_mutex_);
+    if (auto iter = traffic_lights_.find(traffic_light_id); iter != std::end(traffic_lights_)) {
+      return iter->second;
+    }
   }
+  std::unique_lock<std::shared_mutex> lock(traffic_lights_mutex_);
+  return traffic_lights_.try_emplace(traffic_light_id, traffic_light_id, *hdmap_).first->second;
 }
 
 auto TrafficLightManager::getTrafficLights() const -> const TrafficLightMap &
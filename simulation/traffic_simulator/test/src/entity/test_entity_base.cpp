@@ -0,0 +1,84 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <memory>
+#include <string>
+#include <traffic_simulator/entity/misc_object_entity.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+#include "../expect_eq_macros.hpp"
+
+namespace
+{
+auto makeHdMapUtils() -> std::shared_ptr<hdmap_utils::HdMapUtils>
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  return std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+}
+
+auto makeStatus(
+  const std::string & name, const double s, const double speed,
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils)
+  -> traffic_simulator::CanonicalizedEntityStatus
+{
+  traffic_simulator::EntityStatus status;
+  status.name = name;
+  status.lanelet_pose_valid = true;
+  status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(34513, s, 0);
+  status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+  status.action_status = traffic_simulator::helper::constructActionStatus(speed);
+  return traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils);
+}
+}  // namespace
+
+/**
+ * @note Traffic sources move an entity that left the map back to a spawn pose instead of spawning a
+ * new one, which must not keep the history of its previous life.
+ */
+TEST(EntityBase, resetForReuse)
+{
+  const auto hdmap_utils = makeHdMapUtils();
+  auto entity = traffic_simulator::entity::MiscObjectEntity(
+    "object", makeStatus("object", 20.0, 0.0, hdmap_utils), hdmap_utils,
+    traffic_simulator_msgs::msg::MiscObjectParameters());
+  entity.startNpcLogic();
+  entity.onUpdate(0.0, 0.1);
+  entity.updateStandStillDuration(0.1);
+  entity.setStatus(makeStatus("object", 20.0, 5.0, hdmap_utils));
+  entity.updateTraveledDistance(0.1);
+  ASSERT_GT(entity.getStandStillDuration(), 0.0);
+  ASSERT_GT(entity.getTraveledDistance(), 0.0);
+
+  const auto respawn_status = makeStatus("object", 1.0, 5.0, hdmap_utils);
+  entity.setStatus(respawn_status);
+  entity.resetForReuse();
+  EXPECT_DOUBLE_EQ(entity.getStandStillDuration(), 0.0);
+  EXPECT_DOUBLE_EQ(entity.getTraveledDistance(), 0.0);
+  /// @note A stale status before update makes the entity look like it jumped in a single frame.
+  EXPECT_POSE_EQ(entity.getEntityStatusBeforeUpdate().getMapPose(), respawn_status.getMapPose());
+  EXPECT_TWIST_EQ(entity.getEntityStatusBeforeUpdate().getTwist(), respawn_status.getTwist());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
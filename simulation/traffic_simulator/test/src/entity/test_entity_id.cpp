@@ -0,0 +1,118 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/data_type/entity_id.hpp>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/entity/misc_object_entity.hpp>
+
+namespace
+{
+/// @note Configuration requires a directory containing both *.osm and *.pcd files.
+auto makeMapDirectory() -> boost::filesystem::path
+{
+  const auto directory =
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("map-%%%%-%%%%");
+  boost::filesystem::create_directories(directory);
+  boost::filesystem::copy_file(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    directory / "lanelet2_map.osm");
+  std::ofstream((directory / "pointcloud_map.pcd").string());
+  return directory;
+}
+
+auto spawnMiscObject(traffic_simulator::entity::EntityManager & manager, const std::string & name)
+{
+  return manager.spawnEntity<traffic_simulator::entity::MiscObjectEntity>(
+    name, geometry_msgs::msg::Pose(), traffic_simulator_msgs::msg::MiscObjectParameters());
+}
+}  // namespace
+
+TEST(EntityId, toIndex)
+{
+  using traffic_simulator::EntityId;
+  EXPECT_EQ(traffic_simulator::toIndex(EntityId{0}), static_cast<std::size_t>(0));
+  EXPECT_EQ(traffic_simulator::toIndex(EntityId{5}), static_cast<std::size_t>(5));
+}
+
+TEST(EntityId, toHandle)
+{
+  /// @note Handle 0 is reserved for "no handle".
+  EXPECT_EQ(traffic_simulator::toHandle(traffic_simulator::EntityId{0}), 1u);
+  EXPECT_EQ(traffic_simulator::toHandle(traffic_simulator::EntityId{5}), 6u);
+}
+
+TEST(EntityId, allocation)
+{
+  const auto map_directory = makeMapDirectory();
+  {
+    traffic_simulator::entity::EntityManager manager(
+      std::make_shared<rclcpp::Node>("test_entity_id"),
+      traffic_simulator::Configuration(map_directory));
+
+    EXPECT_TRUE(spawnMiscObject(manager, "a"));
+    EXPECT_TRUE(spawnMiscObject(manager, "b"));
+    EXPECT_TRUE(spawnMiscObject(manager, "c"));
+    EXPECT_EQ(toIndex(manager.getEntityId("a")), static_cast<std::size_t>(0));
+    EXPECT_EQ(toIndex(manager.getEntityId("b")), static_cast<std::size_t>(1));
+    EXPECT_EQ(toIndex(manager.getEntityId("c")), static_cast<std::size_t>(2));
+    EXPECT_EQ(toHandle(manager.getEntityId("c")), 3u);
+
+    EXPECT_THROW(manager.getEntityId("unknown"), common::SemanticError);
+    EXPECT_THROW(spawnMiscObject(manager, "a"), common::SemanticError);
+  }
+  boost::filesystem::remove_all(map_directory);
+}
+
+TEST(EntityId, noReuseAfterDespawn)
+{
+  const auto map_directory = makeMapDirectory();
+  {
+    traffic_simulator::entity::EntityManager manager(
+      std::make_shared<rclcpp::Node>("test_entity_id"),
+      traffic_simulator::Configuration(map_directory));
+
+    EXPECT_TRUE(spawnMiscObject(manager, "a"));
+    EXPECT_TRUE(spawnMiscObject(manager, "b"));
+    EXPECT_TRUE(spawnMiscObject(manager, "c"));
+    EXPECT_TRUE(manager.despawnEntity("b"));
+
+    /// @note The despawned entity keeps its id, so a handle resolved before despawning stays valid.
+    EXPECT_EQ(toIndex(manager.getEntityId("b")), static_cast<std::size_t>(1));
+    EXPECT_EQ(manager.getEntityName(traffic_simulator::EntityId{1}), "b");
+
+    EXPECT_TRUE(spawnMiscObject(manager, "d"));
+    EXPECT_EQ(toIndex(manager.getEntityId("d")), static_cast<std::size_t>(3));
+    EXPECT_EQ(toHandle(manager.getEntityId("d")), 4u);
+    EXPECT_EQ(manager.getEntityName(traffic_simulator::EntityId{3}), "d");
+  }
+  boost::filesystem::remove_all(map_directory);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
@@ -0,0 +1,117 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/entity/vehicle_entity.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <vector>
+
+#include "../catalogs.hpp"
+
+namespace
+{
+/// @note Configuration requires a directory containing both *.osm and *.pcd files.
+auto makeMapDirectory() -> boost::filesystem::path
+{
+  const auto directory =
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("map-%%%%-%%%%");
+  boost::filesystem::create_directories(directory);
+  boost::filesystem::copy_file(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    directory / "lanelet2_map.osm");
+  std::ofstream((directory / "pointcloud_map.pcd").string());
+  return directory;
+}
+
+auto makeEntityManager(
+  const std::string & node_name, const boost::filesystem::path & map_directory,
+  const std::size_t npc_logic_update_threads)
+{
+  auto configuration = traffic_simulator::Configuration(map_directory);
+  configuration.npc_logic_update_threads = npc_logic_update_threads;
+  return std::make_unique<traffic_simulator::entity::EntityManager>(
+    std::make_shared<rclcpp::Node>(node_name), configuration);
+}
+
+/**
+ * @brief Spawn vehicles, several of them on the same lanelet, so that NPCs follow each other and
+ * query the map around them.
+ */
+auto spawnVehicles(traffic_simulator::entity::EntityManager & manager) -> std::vector<std::string>
+{
+  std::vector<std::string> names;
+  for (const auto lanelet_id : {34513, 34510, 34564, 34576, 34981, 34579}) {
+    for (const auto s : {2.0, 12.0}) {
+      const auto name = "npc" + std::to_string(names.size());
+      manager.spawnEntity<traffic_simulator::entity::VehicleEntity>(
+        name,
+        traffic_simulator::CanonicalizedLaneletPose(
+          traffic_simulator::helper::constructLaneletPose(lanelet_id, s),
+          manager.getHdmapUtils()),
+        getVehicleParameters());
+      /// @note Vehicles behind go faster, so that they catch up with those in front.
+      manager.requestSpeedChange(name, s < 10.0 ? 15.0 : 5.0, true);
+      names.push_back(name);
+    }
+  }
+  return names;
+}
+}  // namespace
+
+TEST(EntityManager, parallelNpcLogicMatchesSerialNpcLogic)
+{
+  constexpr auto frames = 100;
+  constexpr auto step_time = 0.05;
+
+  const auto map_directory = makeMapDirectory();
+  {
+    const auto serial = makeEntityManager("serial", map_directory, 1);
+    const auto parallel = makeEntityManager("parallel", map_directory, 4);
+
+    const auto names = spawnVehicles(*serial);
+    EXPECT_EQ(spawnVehicles(*parallel), names);
+
+    serial->startNpcLogic();
+    parallel->startNpcLogic();
+
+    for (auto frame = 0; frame < frames; ++frame) {
+      serial->update(frame * step_time, step_time);
+      parallel->update(frame * step_time, step_time);
+      for (const auto & name : names) {
+        ASSERT_EQ(
+          static_cast<traffic_simulator::EntityStatus>(serial->getEntityStatus(name)),
+          static_cast<traffic_simulator::EntityStatus>(parallel->getEntityStatus(name)))
+          << name << " differs at frame " << frame;
+      }
+    }
+  }
+  boost::filesystem::remove_all(map_directory);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
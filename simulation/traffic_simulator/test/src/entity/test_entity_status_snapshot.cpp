@@ -0,0 +1,118 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_status_snapshot.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <utility>
+
+namespace
+{
+auto makeHdMapUtils() -> std::shared_ptr<hdmap_utils::HdMapUtils>
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  return std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+}
+
+auto makeStatus(
+  const std::string & name, const lanelet::Id lanelet_id, const double s,
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils)
+  -> traffic_simulator::CanonicalizedEntityStatus
+{
+  traffic_simulator::EntityStatus status;
+  status.name = name;
+  status.bounding_box.dimensions.x = 4.0;
+  status.bounding_box.dimensions.y = 2.0;
+  status.lanelet_pose_valid = true;
+  status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(lanelet_id, s, 0);
+  status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+  return traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils);
+}
+}  // namespace
+
+TEST(EntityStatusSnapshot, getEntitiesOnLanelet)
+{
+  using traffic_simulator::EntityId;
+  const auto hdmap_utils = makeHdMapUtils();
+  traffic_simulator::entity::EntityStatusSnapshot::Statuses statuses;
+  statuses.emplace_back(EntityId{0}, makeStatus("front", 34513, 5.0, hdmap_utils));
+  statuses.emplace_back(EntityId{1}, makeStatus("rear", 34513, 1.0, hdmap_utils));
+  statuses.emplace_back(EntityId{2}, makeStatus("next", 34510, 1.0, hdmap_utils));
+  const traffic_simulator::entity::EntityStatusSnapshot snapshot(std::move(statuses));
+  EXPECT_EQ(snapshot.getEntitiesOnLanelet(34513).size(), static_cast<std::size_t>(2));
+  EXPECT_EQ(snapshot.getEntitiesOnLanelet(34510).size(), static_cast<std::size_t>(1));
+  EXPECT_TRUE(snapshot.getEntitiesOnLanelet(120659).empty());
+  EXPECT_TRUE(snapshot.contains("next"));
+  EXPECT_FALSE(snapshot.contains("ego"));
+}
+
+TEST(EntityStatusSnapshot, getEntitiesNear)
+{
+  using traffic_simulator::EntityId;
+  const auto hdmap_utils = makeHdMapUtils();
+  traffic_simulator::entity::EntityStatusSnapshot::Statuses statuses;
+  statuses.emplace_back(EntityId{0}, makeStatus("near", 34513, 5.0, hdmap_utils));
+  statuses.emplace_back(EntityId{1}, makeStatus("far", 34411, 1.0, hdmap_utils));
+  const traffic_simulator::entity::EntityStatusSnapshot snapshot(std::move(statuses));
+  const auto point = snapshot.at("near").getMapPose().position;
+  const auto entries = snapshot.getEntitiesNear(point, 1.0);
+  EXPECT_TRUE(std::any_of(entries.begin(), entries.end(), [](const auto entry) {
+    return entry->second.getName() == "near";
+  }));
+  for (const auto & entry : entries) {
+    const auto position = entry->second.getMapPose().position;
+    EXPECT_LE(std::hypot(position.x - point.x, position.y - point.y), 1.0 + std::hypot(2.0, 1.0));
+  }
+  EXPECT_EQ(
+    snapshot.getEntitiesNear(point, std::numeric_limits<double>::infinity()).size(),
+    static_cast<std::size_t>(2));
+}
+
+TEST(EntityStatusSnapshot, lookupByIdAndName)
+{
+  using traffic_simulator::EntityId;
+  const auto hdmap_utils = makeHdMapUtils();
+  traffic_simulator::entity::EntityStatusSnapshot::Statuses statuses;
+  statuses.emplace_back(EntityId{0}, makeStatus("first", 34513, 5.0, hdmap_utils));
+  /// @note Ids of despawned entities are not in the snapshot.
+  statuses.emplace_back(EntityId{2}, makeStatus("third", 34510, 1.0, hdmap_utils));
+  const traffic_simulator::entity::EntityStatusSnapshot snapshot(std::move(statuses));
+  EXPECT_TRUE(snapshot.contains(EntityId{0}));
+  EXPECT_FALSE(snapshot.contains(EntityId{1}));
+  EXPECT_TRUE(snapshot.contains(EntityId{2}));
+  EXPECT_FALSE(snapshot.contains(EntityId{3}));
+  EXPECT_EQ(snapshot.at(EntityId{2}).getName(), "third");
+  EXPECT_EQ(&snapshot.at(EntityId{2}), &snapshot.at("third"));
+  EXPECT_EQ(snapshot.getEntityId("third"), EntityId{2});
+  EXPECT_FALSE(snapshot.getEntityId("second").has_value());
+  EXPECT_THROW(snapshot.at(EntityId{1}), common::SimulationError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
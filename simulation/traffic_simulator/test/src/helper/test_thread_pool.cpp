@@ -0,0 +1,53 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <traffic_simulator/helper/thread_pool.hpp>
+#include <vector>
+
+TEST(ThreadPool, parallelFor)
+{
+  traffic_simulator::helper::ThreadPool thread_pool(3);
+  for (int repeat = 0; repeat < 100; ++repeat) {
+    std::vector<std::size_t> values(1000, 0);
+    thread_pool.parallelFor(values.size(), [&](const auto index) { values[index] = index * 2; });
+    for (std::size_t index = 0; index < values.size(); ++index) {
+      EXPECT_EQ(values[index], index * 2);
+    }
+  }
+}
+
+TEST(ThreadPool, parallelForRethrowsFirstException)
+{
+  traffic_simulator::helper::ThreadPool thread_pool(3);
+  try {
+    thread_pool.parallelFor(100, [](const auto index) {
+      if (index == 7 or index == 42) {
+        throw std::runtime_error(std::to_string(index));
+      }
+    });
+    FAIL() << "parallelFor did not throw.";
+  } catch (const std::runtime_error & error) {
+    EXPECT_EQ(std::string(error.what()), "7");
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -59,6 +59,51 @@ TEST(HdMapUtils, MatchToLane)
   }
 }
 
+TEST(HdMapUtils, ToLaneletPose)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto lanelet_pose = hdmap_utils.toLaneletPose(
+    hdmap_utils.toMapPose(traffic_simulator::helper::constructLaneletPose(34513, 5, 0)).pose,
+    false);
+  EXPECT_TRUE(lanelet_pose);
+  EXPECT_EQ(lanelet_pose.value().lanelet_id, 34513);
+  EXPECT_NEAR(lanelet_pose.value().s, 5.0, 0.1);
+  EXPECT_NEAR(lanelet_pose.value().offset, 0.0, 0.1);
+}
+
+/// @note Poses across the lane and beyond its boundaries must match the same lanelet as matching
+/// the candidates from getNearbyLaneletIds one by one without the centerline index.
+TEST(HdMapUtils, ToLaneletPoseNearBoundaries)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  for (const double s : {1.0, 5.0, 10.0}) {
+    for (double offset = -3.0; offset <= 3.0; offset += 0.25) {
+      const auto pose =
+        hdmap_utils.toMapPose(traffic_simulator::helper::constructLaneletPose(34513, s, offset))
+          .pose;
+      const auto expected = hdmap_utils.toLaneletPose(
+        pose, hdmap_utils.getNearbyLaneletIds(pose.position, 0.1, false), 1.0);
+      const auto actual = hdmap_utils.toLaneletPose(pose, false, 1.0);
+      ASSERT_EQ(actual.has_value(), expected.has_value()) << "s = " << s << ", offset = " << offset;
+      if (expected) {
+        EXPECT_EQ(actual->lanelet_id, expected->lanelet_id);
+        EXPECT_NEAR(actual->s, expected->s, 0.01);
+        EXPECT_NEAR(actual->offset, expected->offset, 0.01);
+      }
+    }
+  }
+}
+
 TEST(HdMapUtils, AlongLaneletPose)
 {
   std::string path =
@@ -102,6 +147,21 @@ TEST(HdMapUtils, AlongLaneletPose)
     hdmap_utils.getLaneletLength(34684) - 10.0);
 }
 
+TEST(HdMapUtils, LongitudinalDistance)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto distance = hdmap_utils.getLongitudinalDistance(
+    traffic_simulator::helper::constructLaneletPose(34513, 5, 0),
+    traffic_simulator::helper::constructLaneletPose(34510, 10, 0));
+  EXPECT_TRUE(distance);
+  EXPECT_DOUBLE_EQ(distance.value(), hdmap_utils.getLaneletLength(34513) - 5.0 + 10.0);
+}
+
 TEST(HdMapUtils, RoadShoulder)
 {
   std::string path = ament_index_cpp::get_package_share_directory("traffic_simulator") +
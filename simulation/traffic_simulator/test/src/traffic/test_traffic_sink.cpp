@@ -0,0 +1,95 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <map>
+#include <string>
+#include <traffic_simulator/traffic/traffic_sink.hpp>
+#include <vector>
+
+namespace
+{
+auto makePoint(const double x, const double y) -> geometry_msgs::msg::Point
+{
+  geometry_msgs::msg::Point point;
+  point.x = x;
+  point.y = y;
+  return point;
+}
+
+auto runSink(
+  const double radius, const std::vector<geometry_msgs::msg::Point> & sinks,
+  const std::map<std::string, geometry_msgs::msg::Point> & entities) -> std::vector<std::string>
+{
+  std::vector<std::string> despawned;
+  traffic_simulator::traffic::TrafficSink sink(
+    radius, sinks,
+    [&]() {
+      std::vector<std::string> names;
+      for (const auto & [name, position] : entities) {
+        names.push_back(name);
+      }
+      return names;
+    },
+    [&](const std::string & name) {
+      geometry_msgs::msg::Pose pose;
+      pose.position = entities.at(name);
+      return pose;
+    },
+    [&](const std::string & name) { despawned.push_back(name); });
+  sink.execute();
+  return despawned;
+}
+}  // namespace
+
+TEST(TrafficSink, despawnEntitiesWithinRadius)
+{
+  EXPECT_EQ(
+    runSink(
+      1.0, {makePoint(0.0, 0.0), makePoint(100.0, -50.0)},
+      {{"a", makePoint(0.5, 0.5)},
+       {"b", makePoint(1.5, 0.0)},
+       {"c", makePoint(99.2, -50.3)},
+       {"d", makePoint(50.0, -25.0)}}),
+    (std::vector<std::string>{"a", "c"}));
+}
+
+TEST(TrafficSink, despawnEntitiesAcrossCellBoundary)
+{
+  EXPECT_EQ(
+    runSink(
+      2.0, {makePoint(1.9, -0.1)}, {{"a", makePoint(-0.05, 0.1)}, {"b", makePoint(4.0, 0.0)}}),
+    (std::vector<std::string>{"a"}));
+}
+
+TEST(TrafficSink, despawnEntityOnlyOnceWithOverlappingSinks)
+{
+  EXPECT_EQ(
+    runSink(1.0, {makePoint(0.0, 0.0), makePoint(0.5, 0.0)}, {{"a", makePoint(0.25, 0.0)}}),
+    (std::vector<std::string>{"a"}));
+}
+
+TEST(TrafficSink, doNothingWithoutSinks)
+{
+  EXPECT_TRUE(runSink(1.0, {}, {{"a", makePoint(0.0, 0.0)}}).empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
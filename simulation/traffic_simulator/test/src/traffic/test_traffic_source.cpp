@@ -0,0 +1,133 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct TrafficSourceTest : public testing::Test
+{
+  auto makeSource(const double rate, const std::size_t max_entities)
+    -> traffic_simulator::traffic::TrafficSource
+  {
+    return traffic_simulator::traffic::TrafficSource(
+      "source", rate, max_entities,
+      {traffic_simulator::helper::constructLaneletPose(1, 0.0, 0.0),
+       traffic_simulator::helper::constructLaneletPose(2, 0.0, 0.0)},
+      [this]() { return current_time; }, [this](const auto &) { return spawn_pose_free; },
+      [this](const auto & name, const auto & lanelet_pose) {
+        spawned.emplace_back(name, lanelet_pose.lanelet_id);
+      },
+      [this](const auto & name, const auto & lanelet_pose) {
+        respawned.emplace_back(name, lanelet_pose.lanelet_id);
+      });
+  }
+
+  double current_time = 0.0;
+
+  bool spawn_pose_free = true;
+
+  std::vector<std::pair<std::string, lanelet::Id>> spawned;
+
+  std::vector<std::pair<std::string, lanelet::Id>> respawned;
+};
+}  // namespace
+
+TEST_F(TrafficSourceTest, emitAtRateUntilPopulationIsFull)
+{
+  auto source = makeSource(2.0, 3);
+  for (; current_time < 5.0; current_time += 0.1) {
+    source.execute();
+  }
+  EXPECT_EQ(
+    spawned, (std::vector<std::pair<std::string, lanelet::Id>>{
+               {"source_0", 1}, {"source_1", 2}, {"source_2", 1}}));
+  EXPECT_EQ(source.getEntityNames().size(), 3U);
+}
+
+TEST_F(TrafficSourceTest, recycleReleasedEntities)
+{
+  auto source = makeSource(10.0, 2);
+  source.execute();
+  current_time = 0.1;
+  source.execute();
+  current_time = 0.2;
+  EXPECT_TRUE(source.release("source_0"));
+  EXPECT_FALSE(source.release("other"));
+  current_time = 10.0;
+  source.execute();
+  EXPECT_EQ(spawned.size(), 2U);
+  EXPECT_EQ(
+    respawned, (std::vector<std::pair<std::string, lanelet::Id>>{{"source_0", 1}}));
+}
+
+TEST_F(TrafficSourceTest, despawnReleasedEntitiesBeforeEmissionIsDue)
+{
+  auto source = makeSource(1.0, 1);
+  source.execute();
+  current_time = 0.5;
+  EXPECT_FALSE(source.release("source_0"));
+  EXPECT_TRUE(source.getEntityNames().empty());
+  EXPECT_TRUE(respawned.empty());
+  current_time = 1.0;
+  source.execute();
+  EXPECT_EQ(spawned.size(), 2U);
+}
+
+TEST_F(TrafficSourceTest, waitForFreeSpawnPose)
+{
+  auto source = makeSource(2.0, 3);
+  spawn_pose_free = false;
+  source.execute();
+  current_time = 1.0;
+  source.execute();
+  EXPECT_TRUE(spawned.empty());
+  spawn_pose_free = true;
+  current_time = 1.05;
+  source.execute();
+  EXPECT_EQ(spawned.size(), 1U);
+  spawn_pose_free = false;
+  current_time = 2.0;
+  EXPECT_FALSE(source.release("source_0"));
+  EXPECT_TRUE(respawned.empty());
+}
+
+TEST_F(TrafficSourceTest, forgetEntitiesDespawnedElsewhere)
+{
+  auto source = makeSource(10.0, 1);
+  source.execute();
+  source.forget("source_0");
+  EXPECT_TRUE(source.getEntityNames().empty());
+  current_time = 0.1;
+  source.execute();
+  EXPECT_EQ(spawned.size(), 2U);
+}
+
+TEST_F(TrafficSourceTest, rejectNonPositiveRate)
+{
+  EXPECT_THROW(makeSource(0.0, 1), common::SemanticError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
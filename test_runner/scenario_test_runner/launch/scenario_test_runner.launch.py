@@ -63,6 +63,9 @@ def launch_setup(context, *args, **kwargs):
     architecture_type               = LaunchConfiguration("architecture_type",              default="awf/universe")
     autoware_launch_file            = LaunchConfiguration("autoware_launch_file",           default=default_autoware_launch_file_of(architecture_type.perform(context)))
     autoware_launch_package         = LaunchConfiguration("autoware_launch_package",        default=default_autoware_launch_package_of(architecture_type.perform(context)))
+    context_publish_mode            = LaunchConfiguration("context_publish_mode",           default="full")
+    context_publish_rate            = LaunchConfiguration("context_publish_rate",           default=0.0)
+    context_snapshot_interval       = LaunchConfiguration("context_snapshot_interval",      default=30)
     global_frame_rate               = LaunchConfiguration("global_frame_rate",              default=30.0)
     global_real_time_factor         = LaunchConfiguration("global_real_time_factor",        default=1.0)
     global_timeout                  = LaunchConfiguration("global_timeout",                 default=180)
@@ -70,11 +73,15 @@ def launch_setup(context, *args, **kwargs):
     launch_autoware                 = LaunchConfiguration("launch_autoware",                default=True)
     launch_rviz                     = LaunchConfiguration("launch_rviz",                    default=False)
     launch_simple_sensor_simulator  = LaunchConfiguration("launch_simple_sensor_simulator", default=True)
+    npc_logic_update_threads        = LaunchConfiguration("npc_logic_update_threads",       default=1)
     output_directory                = LaunchConfiguration("output_directory",               default=Path("/tmp"))
+    pipelined_frame_update          = LaunchConfiguration("pipelined_frame_update",         default=False)
     port                            = LaunchConfiguration("port",                           default=5555)
+    publish_autoware_status_on_simulation_step = LaunchConfiguration("publish_autoware_status_on_simulation_step", default=False)
     record                          = LaunchConfiguration("record",                         default=True)
     rviz_config                     = LaunchConfiguration("rviz_config",                    default="")
     scenario                        = LaunchConfiguration("scenario",                       default=Path("/dev/null"))
+    send_entity_status_delta        = LaunchConfiguration("send_entity_status_delta",       default=False)
     sensor_model                    = LaunchConfiguration("sensor_model",                   default="")
     sigterm_timeout                 = LaunchConfiguration("sigterm_timeout",                default=8)
     vehicle_model                   = LaunchConfiguration("vehicle_model",                  default="")
@@ -84,17 +91,24 @@ def launch_setup(context, *args, **kwargs):
     print(f"architecture_type       := {architecture_type.perform(context)}")
     print(f"autoware_launch_file    := {autoware_launch_file.perform(context)}")
     print(f"autoware_launch_package := {autoware_launch_package.perform(context)}")
+    print(f"context_publish_mode    := {context_publish_mode.perform(context)}")
+    print(f"context_publish_rate    := {context_publish_rate.perform(context)}")
+    print(f"context_snapshot_interval := {context_snapshot_interval.perform(context)}")
     print(f"global_frame_rate       := {global_frame_rate.perform(context)}")
     print(f"global_real_time_factor := {global_real_time_factor.perform(context)}")
     print(f"global_timeout          := {global_timeout.perform(context)}")
     print(f"initialize_duration     := {initialize_duration.perform(context)}")
     print(f"launch_autoware         := {launch_autoware.perform(context)}")
     print(f"launch_rviz             := {launch_rviz.perform(context)}")
+    print(f"npc_logic_update_threads:= {npc_logic_update_threads.perform(context)}")
     print(f"output_directory        := {output_directory.perform(context)}")
+    print(f"pipelined_frame_update  := {pipelined_frame_update.perform(context)}")
     print(f"port                    := {port.perform(context)}")
+    print(f"publish_autoware_status_on_simulation_step := {publish_autoware_status_on_simulation_step.perform(context)}")
     print(f"record                  := {record.perform(context)}")
     print(f"rviz_config             := {rviz_config.perform(context)}")
     print(f"scenario                := {scenario.perform(context)}")
+    print(f"send_entity_status_delta:= {send_entity_status_delta.perform(context)}")
     print(f"sensor_model            := {sensor_model.perform(context)}")
     print(f"sigterm_timeout         := {sigterm_timeout.perform(context)}")
     print(f"vehicle_model           := {vehicle_model.perform(context)}")
@@ -105,11 +119,17 @@ def launch_setup(context, *args, **kwargs):
             {"architecture_type": architecture_type},
             {"autoware_launch_file": autoware_launch_file},
             {"autoware_launch_package": autoware_launch_package},
+            {"context_publish_mode": context_publish_mode},
+            {"context_publish_rate": context_publish_rate},
+            {"context_snapshot_interval": context_snapshot_interval},
             {"initialize_duration": initialize_duration},
             {"launch_autoware": launch_autoware},
+            {"npc_logic_update_threads": npc_logic_update_threads},
+            {"pipelined_frame_update": pipelined_frame_update},
             {"port": port},
             {"record": record},
             {"rviz_config": rviz_config},
+            {"send_entity_status_delta": send_entity_status_delta},
             {"sensor_model": sensor_model},
             {"vehicle_model": vehicle_model},
         ]
@@ -134,14 +154,21 @@ def launch_setup(context, *args, **kwargs):
         DeclareLaunchArgument("architecture_type",       default_value=architecture_type      ),
         DeclareLaunchArgument("autoware_launch_file",    default_value=autoware_launch_file   ),
         DeclareLaunchArgument("autoware_launch_package", default_value=autoware_launch_package),
+        DeclareLaunchArgument("context_publish_mode",    default_value=context_publish_mode   ),
+        DeclareLaunchArgument("context_publish_rate",    default_value=context_publish_rate   ),
+        DeclareLaunchArgument("context_snapshot_interval", default_value=context_snapshot_interval),
         DeclareLaunchArgument("global_frame_rate",       default_value=global_frame_rate      ),
         DeclareLaunchArgument("global_real_time_factor", default_value=global_real_time_factor),
         DeclareLaunchArgument("global_timeout",          default_value=global_timeout         ),
         DeclareLaunchArgument("launch_autoware",         default_value=launch_autoware        ),
         DeclareLaunchArgument("launch_rviz",             default_value=launch_rviz            ),
+        DeclareLaunchArgument("npc_logic_update_threads", default_value=npc_logic_update_threads),
         DeclareLaunchArgument("output_directory",        default_value=output_directory       ),
+        DeclareLaunchArgument("pipelined_frame_update",  default_value=pipelined_frame_update ),
+        DeclareLaunchArgument("publish_autoware_status_on_simulation_step", default_value=publish_autoware_status_on_simulation_step),
         DeclareLaunchArgument("rviz_config",             default_value=rviz_config            ),
         DeclareLaunchArgument("scenario",                default_value=scenario               ),
+        DeclareLaunchArgument("send_entity_status_delta", default_value=send_entity_status_delta),
         DeclareLaunchArgument("sensor_model",            default_value=sensor_model           ),
         DeclareLaunchArgument("sigterm_timeout",         default_value=sigterm_timeout        ),
         DeclareLaunchArgument("vehicle_model",           default_value=vehicle_model          ),
@@ -171,7 +198,10 @@ def launch_setup(context, *args, **kwargs):
             namespace="simulation",
             output="screen",
             on_exit=ShutdownOnce(),
-            parameters=[{"port": port}]+make_vehicle_parameters(),
+            parameters=[
+                {"port": port},
+                {"publish_autoware_status_on_simulation_step": publish_autoware_status_on_simulation_step},
+            ]+make_vehicle_parameters(),
             condition=IfCondition(launch_simple_sensor_simulator),
         ),
         # The `name` keyword overrides the name for all created nodes, so duplicated nodes appear.